@@ -30,6 +30,4 @@ mkdir -p $PREFIX/bin
 cd ..
 
 cp -r ./build-conda/bin/kmdiff $PREFIX/bin
-cp -r ./build-conda/bin/smartpca $PREFIX/bin
-cp -r ./build-conda/bin/evec2pca.perl $PREFIX/bin
 
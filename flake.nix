@@ -24,8 +24,6 @@
         pkgs.gtest
         pkgs.zstd
         pkgs.virtualenv
-        pkgs.lapack
-        pkgs.openblas
       ];
     in rec {
       devShell = pkgs.mkShell.override { stdenv = pkgs.stdenvNoCC; } {
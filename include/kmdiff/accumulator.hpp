@@ -18,11 +18,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <fstream>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <queue>
+#include <streambuf>
 #include <type_traits>
 
 #include <robin_hood.h>
+#include <xxhash.h>
 
 #include <kmdiff/kmer.hpp>
 #include <kmdiff/utils.hpp>
@@ -49,6 +57,12 @@ namespace kmdiff {
     virtual std::optional<T>& get() = 0;
     virtual void destroy() = 0;
 
+    // Drops what was pushed, when the producer failed before the end.
+    virtual void abort() { destroy(); }
+
+    // Checksum of the finished file, 0 if the accumulator does not write one.
+    virtual std::uint64_t checksum() const { return 0; }
+
    protected:
     std::optional<T> m_opt;
   };
@@ -153,13 +167,60 @@ namespace kmdiff {
     iterator m_it;
   };
 
+  /*
+    Output file buffer which hashes the bytes it writes, so that the checksum of a file is known
+    once written, without reading it back. Same hash as file_checksum.
+  */
+  class checksum_filebuf : public std::streambuf
+  {
+   public:
+    explicit checksum_filebuf(const std::string& path)
+      : m_state(XXH64_createState(), XXH64_freeState)
+    {
+      m_buf.open(path, std::ios::out | std::ios::binary);
+      XXH64_reset(m_state.get(), 0);
+    }
+
+    bool is_open() const { return m_buf.is_open(); }
+
+    bool close() { return m_buf.close() != nullptr; }
+
+    std::uint64_t checksum() const { return XXH64_digest(m_state.get()); }
+
+   protected:
+    int_type overflow(int_type c) override
+    {
+      if (traits_type::eq_int_type(c, traits_type::eof()))
+        return traits_type::not_eof(c);
+      char ch = traits_type::to_char_type(c);
+      return xsputn(&ch, 1) == 1 ? c : traits_type::eof();
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+      std::streamsize w = m_buf.sputn(s, n);
+      if (w > 0)
+        XXH64_update(m_state.get(), s, w);
+      return w;
+    }
+
+    int sync() override
+    {
+      return m_buf.pubsync();
+    }
+
+   private:
+    std::filebuf m_buf;
+    std::unique_ptr<XXH64_state_t, decltype(&XXH64_freeState)> m_state;
+  };
+
   template <typename T>
   class FileAccumulator : public IAccumulator<T>
   {
     using o_stream_t = std::ostream;
     using i_stream_t = std::istream;
 
-    using out_stream_t = std::ofstream;
+    using out_stream_t = std::ostream;
     using in_stream_t = std::ifstream;
 
     using cpr_out_stream_t = lz4_stream::basic_ostream<8192>;
@@ -169,9 +230,11 @@ namespace kmdiff {
     FileAccumulator(const std::string& path, size_t k_size = 0, bool read = false, bool del = false)
       : m_path(path), m_kmer_size(k_size), m_reading(read), m_del(del)
     {
+      // Written to a temporary file, renamed on finish, so that the file only exists once complete.
       if (!m_reading)
       {
-        m_out_stream = std::make_shared<out_stream_t>(m_path);
+        m_out_buf = std::make_shared<checksum_filebuf>(tmp_path());
+        m_out_stream = std::make_shared<out_stream_t>(m_out_buf.get());
         m_cout_stream = std::make_shared<cpr_out_stream_t>(*m_out_stream);
       }
       else
@@ -201,8 +264,12 @@ namespace kmdiff {
     void finish() override
     {
       m_cout_stream.reset();
-      m_out_stream->close();
+      m_out_stream->flush();
       m_out_stream.reset();
+      m_out_buf->close();
+      m_checksum = m_out_buf->checksum();
+      m_out_buf.reset();
+      fs::rename(tmp_path(), m_path);
       m_in_stream = std::make_shared<in_stream_t>(m_path);
       m_cin_stream = std::make_shared<cpr_in_stream_t>(*m_in_stream);
     }
@@ -248,6 +315,11 @@ namespace kmdiff {
       return m_size;
     }
 
+    std::uint64_t checksum() const override
+    {
+      return m_checksum;
+    }
+
     void destroy() override
     {
       if (m_cin_stream)
@@ -262,7 +334,22 @@ namespace kmdiff {
       if (m_del)
       {
         fs::remove(m_path);
+        fs::remove(tmp_path());
+      }
+    }
+
+    // The temporary file is removed, so that a failed partition never gets its final name.
+    void abort() override
+    {
+      if (m_out_stream)
+      {
+        m_cout_stream.reset();
+        m_out_stream.reset();
+        m_out_buf->close();
+        m_out_buf.reset();
+        fs::remove(tmp_path());
       }
+      destroy();
     }
 
     ~FileAccumulator() override
@@ -270,6 +357,12 @@ namespace kmdiff {
       destroy();
     }
 
+   private:
+    std::string tmp_path() const
+    {
+      return m_path + ".tmp";
+    }
+
    private:
     T m_tmp;
     size_t m_size{0};
@@ -278,13 +371,331 @@ namespace kmdiff {
     size_t m_kmer_size{0};
     bool m_reading{false};
     bool m_del{false};
+    std::uint64_t m_checksum{0};
+    std::shared_ptr<checksum_filebuf> m_out_buf{nullptr};
     std::shared_ptr<out_stream_t> m_out_stream{nullptr};
     std::shared_ptr<in_stream_t> m_in_stream{nullptr};
     std::shared_ptr<cpr_out_stream_t> m_cout_stream{nullptr};
     std::shared_ptr<cpr_in_stream_t> m_cin_stream{nullptr};
   };
 
+  /*
+    Forwards the elements to another accumulator, sorted with cmp, on finish. Elements which
+    compare equal keep their push order. With a prefix, at most max_size elements are buffered:
+    full buffers are sorted and spilled to <prefix>.run<i>, and merged on finish. Without, the
+    whole input is buffered.
+  */
+  template <typename T>
+  class SortedAccumulator : public IAccumulator<T>
+  {
+    using cmp_t = std::function<bool(const T&, const T&)>;
+
+    struct head
+    {
+      T value;
+      std::size_t run;
+    };
+
+   public:
+    SortedAccumulator(acc_t<T> acc,
+                      cmp_t cmp,
+                      const std::string& prefix = "",
+                      size_t k_size = 0,
+                      size_t max_size = s_max_size)
+      : m_acc(acc), m_cmp(cmp), m_prefix(prefix), m_kmer_size(k_size),
+        m_max_size(std::max<size_t>(max_size, 1))
+    {}
+
+    void push(T&& e) override
+    {
+      m_data.push_back(std::move(e));
+      if (!m_prefix.empty() && m_data.size() >= m_max_size)
+        spill();
+    }
+
+    void finish() override
+    {
+      if (m_runs.empty())
+      {
+        std::stable_sort(m_data.begin(), m_data.end(), m_cmp);
+        for (auto& e : m_data)
+          m_acc->push(std::move(e));
+        std::vector<T>().swap(m_data);
+      }
+      else
+      {
+        if (!m_data.empty())
+          spill();
+        merge_runs();
+      }
+      m_acc->finish();
+    }
+
+    std::optional<T>& get() override
+    {
+      return m_acc->get();
+    }
+
+    size_t size() const override
+    {
+      return m_acc->size() + m_data.size() + m_spilled;
+    }
+
+    void destroy() override
+    {
+      std::vector<T>().swap(m_data);
+      drop_runs(false);
+      m_acc->destroy();
+    }
+
+    void abort() override
+    {
+      std::vector<T>().swap(m_data);
+      drop_runs(true);
+      m_acc->abort();
+    }
+
+    std::uint64_t checksum() const override
+    {
+      return m_acc->checksum();
+    }
+
+   private:
+    void spill()
+    {
+      std::stable_sort(m_data.begin(), m_data.end(), m_cmp);
+
+      acc_t<T> run = std::make_shared<FileAccumulator<T>>(
+        fmt::format("{}.run{}", m_prefix, m_runs.size()), m_kmer_size, false, true);
+      for (auto& e : m_data)
+        run->push(std::move(e));
+      run->finish();
+
+      m_spilled += m_data.size();
+      m_data.clear();
+      m_runs.push_back(run);
+    }
+
+    // k-way merge of the runs, ties go to the earlier run so that the sort stays stable.
+    void merge_runs()
+    {
+      auto after = [this](const head& a, const head& b) {
+        return m_cmp(b.value, a.value) || (!m_cmp(a.value, b.value) && a.run > b.run);
+      };
+      std::priority_queue<head, std::vector<head>, decltype(after)> heads(after);
+
+      for (std::size_t i = 0; i < m_runs.size(); i++)
+      {
+        if (auto& o = m_runs[i]->get())
+          heads.push({std::move(*o), i});
+      }
+
+      while (!heads.empty())
+      {
+        head h = heads.top();
+        heads.pop();
+        m_acc->push(std::move(h.value));
+        if (auto& o = m_runs[h.run]->get())
+          heads.push({std::move(*o), h.run});
+      }
+
+      drop_runs(false);
+    }
+
+    void drop_runs(bool failed)
+    {
+      for (auto& run : m_runs)
+      {
+        if (failed)
+          run->abort();
+        else
+          run->destroy();
+      }
+      m_runs.clear();
+      m_spilled = 0;
+    }
+
+   private:
+    static constexpr size_t s_max_size = 1 << 20;
+
+   private:
+    acc_t<T> m_acc;
+    cmp_t m_cmp;
+    std::string m_prefix;
+    size_t m_kmer_size {0};
+    size_t m_max_size {s_max_size};
+    std::vector<T> m_data;
+    std::vector<acc_t<T>> m_runs;
+    size_t m_spilled {0};
+  };
+
+  /*
+    Reads another accumulator until an element does not satisfy pred. Over an accumulator sorted
+    on pred, it reads the prefix of the elements which satisfy it, and stops there.
+  */
+  template <typename T>
+  class PrefixAccumulator : public IAccumulator<T>
+  {
+    using pred_t = std::function<bool(const T&)>;
+
+   public:
+    PrefixAccumulator(acc_t<T> acc, pred_t pred)
+      : m_acc(acc), m_pred(pred)
+    {}
+
+    void push(T&& e) override
+    {
+      m_acc->push(std::move(e));
+    }
+
+    void finish() override
+    {
+      m_acc->finish();
+    }
+
+    std::optional<T>& get() override
+    {
+      if (m_end)
+        return this->m_opt;
+
+      auto& o = m_acc->get();
+      if (o && m_pred(*o))
+        return o;
+
+      m_end = true;
+      this->m_opt = std::nullopt;
+      return this->m_opt;
+    }
+
+    size_t size() const override
+    {
+      return m_acc->size();
+    }
+
+    void destroy() override
+    {
+      m_acc->destroy();
+    }
+
+    void abort() override
+    {
+      m_acc->abort();
+    }
+
+    std::uint64_t checksum() const override
+    {
+      return m_acc->checksum();
+    }
+
+   private:
+    acc_t<T> m_acc;
+    pred_t m_pred;
+    bool m_end {false};
+  };
+
   bool partitions_exist(const std::string& prefix, size_t nb_partitions, const std::string& dir);
 
+  std::vector<std::string> partition_paths(const std::string& prefix, size_t nb_partitions, const std::string& dir);
+
+  std::uint64_t file_checksum(const std::string& path);
+
+  /*
+    Hash of the inputs and parameters a stage output depends on. Each value is hashed with its
+    position, and files by content, so that a change of any of them changes the key.
+  */
+  class stage_key
+  {
+    public:
+      explicit stage_key(const std::string& stage) { add(stage); }
+
+      template<typename T>
+      stage_key& add(const T& value)
+      {
+        std::string s = fmt::format("{}\n", value);
+        m_hash = XXH64(s.data(), s.size(), m_hash);
+        return *this;
+      }
+
+      // An empty or missing path is hashed as such.
+      stage_key& add_file(const std::string& path)
+      {
+        if (path.empty() || !fs::exists(path))
+          return add(fmt::format("no file '{}'", path));
+        return add(fmt::format("{:016x}", file_checksum(path)));
+      }
+
+      std::uint64_t value() const { return m_hash; }
+      std::string str() const { return fmt::format("{:016x}", m_hash); }
+
+    private:
+      std::uint64_t m_hash {0};
+  };
+
+  /*
+    Completion log of the partitions of a stage. A partition is appended once its file is
+    committed, with its counts, and the size, mtime and checksum of the file, so that a restarted
+    run only redoes the partitions which are missing, corrupt, or were produced with another key.
+    The key holds the options the partitions depend on. On load, a file is checked on its size
+    and mtime, and only read to verify its checksum when its mtime changed.
+  */
+  class partition_manifest
+  {
+    public:
+      struct entry
+      {
+        std::size_t kmers {0};
+        std::size_t total {0};
+        std::size_t controls {0};
+        std::size_t cases {0};
+        std::uint64_t checksum {0};
+        // P-value up to which the file keeps k-mers, sorted by p-value when retained.
+        double level {0};
+        bool sorted {false};
+        std::uint64_t size {0};
+        std::int64_t mtime {0};
+      };
+
+      partition_manifest(const std::string& path,
+                         const std::string& key,
+                         const std::vector<std::string>& partitions);
+
+      void reset();
+
+      // Committed with this key, and its file still matches the recorded size and checksum.
+      bool done(std::size_t p) const { return m_done[p]; }
+      bool complete() const { return complete(0, m_done.size()); }
+      bool complete(std::size_t first, std::size_t last) const;
+
+      // The last committed entry, which outlives the file of the partition.
+      const std::optional<entry>& get(std::size_t p) const { return m_entries[p]; }
+
+      // Total number of k-mers of the committed partitions.
+      std::size_t total() const;
+
+      // The committed partitions which do not satisfy pred are redone.
+      void keep_if(const std::function<bool(const entry&)>& pred);
+
+      // The checksum is the one of the accumulator which wrote the file, the file is read when
+      // it is 0.
+      void commit(std::size_t p, entry e);
+
+    private:
+      std::string header() const;
+
+    private:
+      static constexpr int s_version = 3;
+
+    private:
+      std::string m_path;
+      std::string m_key;
+      std::vector<std::string> m_partitions;
+      std::vector<std::optional<entry>> m_entries;
+      std::vector<std::uint8_t> m_done;
+      std::ofstream m_out;
+      std::mutex m_mutex;
+  };
+
+  using manifest_t = std::shared_ptr<partition_manifest>;
+
 }  // end of namespace kmdiff
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <iterator>
 #include <string>
 #include <vector>
 #include <queue>
@@ -14,33 +16,50 @@
 #include <kmdiff/kmer.hpp>
 #include <kmdiff/kmtricks_utils.hpp>
 #include <kmdiff/threadpool.hpp>
-#include <kmdiff/blocking_queue.hpp>
+#include <kmdiff/batch_queue.hpp>
 #include <kmdiff/popstrat.hpp>
 #include <kmdiff/kff_utils.hpp>
+#include <kmdiff/bgzf.hpp>
 #include <kmdiff/progress.hpp>
 #include <kmdiff/icorrector.hpp>
 
 namespace kmdiff {
   using pb_t = indicators::ProgressBar*;
 
+  inline std::string output_extension(bool kff, bool gzip)
+  {
+    if (kff)
+      return ".kff";
+    return gzip ? ".fasta.gz" : ".fasta";
+  }
+
   template<size_t MAX_K>
-  static void writer(BlockingQueue<KmerSign<MAX_K>>& queue,
+  static void writer(BatchQueue<KmerSign<MAX_K>>& queue,
                       const std::string& out_path,
                       const std::string& name,
                       bool kff,
+                      bool kff_data,
+                      bool gzip,
+                      std::size_t nb_threads,
                       kmtricks_config_t config,
                       std::size_t& count)
   {
     using seq_out_t = std::unique_ptr<klibpp::SeqStreamOut>;
 
-    KmerSign<MAX_K> k;
+    typename BatchQueue<KmerSign<MAX_K>>::batch_type batch;
     klibpp::KSeq record;
     seq_out_t out = nullptr;
     kff_w_t out_kff = nullptr;
+    bgzf_w_t out_gz = nullptr;
+    fmt::memory_buffer buffer;
 
     if (kff)
     {
-      out_kff = std::make_unique<KffWriter>(out_path, config.kmer_size);
+      out_kff = std::make_unique<KffWriter>(out_path, config.kmer_size, 255, kff_data);
+    }
+    else if (gzip)
+    {
+      out_gz = std::make_unique<BgzfWriter>(out_path, nb_threads);
     }
     else
     {
@@ -48,26 +67,41 @@ namespace kmdiff {
       *out << klibpp::format::fasta;
     }
 
-    while (queue.pop(k))
+    while (queue.pop(batch))
     {
-      if (!kff)
-      {
-        record.name = fmt::format("{}_pval={:g}_control={}_case={}",
-                                  count,
-                                  k.m_pvalue,
-                                  static_cast<std::size_t>(k.m_mean_control),
-                                  k.m_mean_case);
-
-        record.seq = k.m_kmer.to_string();
-        *out << record;
-      }
-      else
+      for (auto& k : batch)
       {
-        out_kff->write(k);
+        if (out_gz)
+        {
+          buffer.clear();
+          fmt::format_to(std::back_inserter(buffer), ">{}_pval={:g}_control={}_case={}\n{}\n",
+                         count,
+                         k.m_pvalue,
+                         static_cast<std::size_t>(k.m_mean_control),
+                         k.m_mean_case,
+                         k.m_kmer.to_string());
+          out_gz->write(buffer.data(), buffer.size());
+        }
+        else if (!kff)
+        {
+          record.name = fmt::format("{}_pval={:g}_control={}_case={}",
+                                    count,
+                                    k.m_pvalue,
+                                    static_cast<std::size_t>(k.m_mean_control),
+                                    k.m_mean_case);
+
+          record.seq = k.m_kmer.to_string();
+          *out << record;
+        }
+        else
+        {
+          out_kff->write(k);
+        }
+        count++;
       }
-      count++;
     }
     if (out_kff) out_kff->close();
+    if (out_gz) out_gz->close();
   }
 
   template<std::size_t KSIZE>
@@ -81,6 +115,8 @@ namespace kmdiff {
                   kmtricks_config_t config,
                   const std::string& output_dir,
                   bool kff,
+                  bool kff_data,
+                  bool gzip,
                   std::size_t nb_threads,
                   pb_t pb = nullptr)
         : m_accumulators(accumulators),
@@ -88,6 +124,8 @@ namespace kmdiff {
           m_config(config),
           m_output(output_dir),
           m_kff(kff),
+          m_kff_data(kff_data),
+          m_gzip(gzip),
           m_nb_threads(nb_threads),
           m_pb(pb)
       {}
@@ -113,9 +151,14 @@ namespace kmdiff {
       std::size_t m_nb_significant {0};
 
       bool m_kff {false};
+      bool m_kff_data {false};
+      bool m_gzip {false};
       std::size_t m_nb_threads {1};
 
       pb_t m_pb {nullptr};
+
+      static constexpr std::size_t s_queue_bytes = 64 << 20;
+      static constexpr std::size_t s_batch_size = 4096;
   };
 
   template<std::size_t KSIZE>
@@ -129,13 +172,16 @@ namespace kmdiff {
                  kmtricks_config_t config,
                  const std::string& output_dir,
                  bool kff,
+                 bool kff_data,
+                 bool gzip,
                  std::size_t nb_threads,
                  pb_t pb = nullptr)
-        : IAggregator<KSIZE>(accumulators, corrector, config, output_dir, kff, nb_threads, pb)
+        : IAggregator<KSIZE>(
+            accumulators, corrector, config, output_dir, kff, kff_data, gzip, nb_threads, pb)
       {}
 
-      static void worker(BlockingQueue<KmerSign<KSIZE>>& controls_queue,
-                         BlockingQueue<KmerSign<KSIZE>>& cases_queue,
+      static void worker(BatchQueue<KmerSign<KSIZE>>& controls_queue,
+                         BatchQueue<KmerSign<KSIZE>>& cases_queue,
                          acc_t<ks_type>& accumulator,
                          corrector_t corrector,
                          kmtricks_config_t config,
@@ -143,6 +189,9 @@ namespace kmdiff {
                          pb_t pb,
                          int thread_id)
       {
+        BatchProducer<ks_type> controls(controls_queue);
+        BatchProducer<ks_type> cases(cases_queue);
+
         while (auto& o = accumulator->get())
         {
           auto& kref = o.value();
@@ -154,17 +203,17 @@ namespace kmdiff {
           {
             if (kref.m_sign == Significance::CONTROL)
             {
-              controls_queue.push(std::move(kref));
+              controls.push(std::move(kref));
             }
             else
             {
-              cases_queue.push(std::move(kref));
+              cases.push(std::move(kref));
             }
           }
         }
 
-        controls_queue.end_signal(partition);
-        cases_queue.end_signal(partition);
+        controls.finish();
+        cases.finish();
 
         if (pb)
           pb->tick();
@@ -175,8 +224,8 @@ namespace kmdiff {
         const auto& nb_part = this->m_config.nb_partitions;
         const auto& nb_threads = this->m_nb_threads;
 
-        BlockingQueue<ks_type> cases_queue(50000, nb_part);
-        BlockingQueue<ks_type> controls_queue(50000, nb_part);
+        BatchQueue<ks_type> cases_queue(this->s_queue_bytes, this->s_batch_size, nb_part);
+        BatchQueue<ks_type> controls_queue(this->s_queue_bytes, this->s_batch_size, nb_part);
 
         ThreadPool pool(nb_threads < 2 ? 1 : nb_threads);
 
@@ -194,7 +243,8 @@ namespace kmdiff {
           pool.add_task(task);
         }
 
-        std::string ext = this->m_kff ? ".kff" : ".fasta";
+        std::string ext = output_extension(this->m_kff, this->m_gzip);
+        std::size_t cpr_threads = std::max<std::size_t>(1, nb_threads / 2);
         std::string control_out = fmt::format("{}/control_kmers{}", this->m_output, ext);
         std::string case_out = fmt::format("{}/case_kmers{}", this->m_output, ext);
 
@@ -203,6 +253,9 @@ namespace kmdiff {
                                           control_out,
                                           "control",
                                           this->m_kff,
+                                          this->m_kff_data,
+                                          this->m_gzip,
+                                          cpr_threads,
                                           this->m_config,
                                           std::ref(this->m_control_count));
 
@@ -211,6 +264,9 @@ namespace kmdiff {
                                        case_out,
                                        "case",
                                        this->m_kff,
+                                       this->m_kff_data,
+                                       this->m_gzip,
+                                       cpr_threads,
                                        this->m_config,
                                        std::ref(this->m_case_count));
 
@@ -231,9 +287,12 @@ namespace kmdiff {
                         kmtricks_config_t config,
                         const std::string& output_dir,
                         bool kff,
+                        bool kff_data,
+                        bool gzip,
                         std::size_t nb_threads,
                         pb_t pb = nullptr)
-        : IAggregator<KSIZE>(accumulators, corrector, config, output_dir, kff, nb_threads, pb)
+        : IAggregator<KSIZE>(
+            accumulators, corrector, config, output_dir, kff, kff_data, gzip, nb_threads, pb)
       {}
 
 
@@ -242,8 +301,8 @@ namespace kmdiff {
         const auto& nb_part = this->m_config.nb_partitions;
         const auto& nb_threads = this->m_nb_threads;
 
-        BlockingQueue<ks_type> cases_queue(50000, nb_part);
-        BlockingQueue<ks_type> controls_queue(50000, nb_part);
+        BatchQueue<ks_type> cases_queue(this->s_queue_bytes, this->s_batch_size, 1);
+        BatchQueue<ks_type> controls_queue(this->s_queue_bytes, this->s_batch_size, 1);
 
         ThreadPool pool(nb_threads < 2 ? 1 : nb_threads);
 
@@ -259,7 +318,8 @@ namespace kmdiff {
         }
         pool.join_all();
 
-        std::string ext = this->m_kff ? ".kff" : ".fasta";
+        std::string ext = output_extension(this->m_kff, this->m_gzip);
+        std::size_t cpr_threads = std::max<std::size_t>(1, nb_threads / 2);
         std::string control_out = fmt::format("{}/control_kmers{}", this->m_output, ext);
         std::string case_out = fmt::format("{}/case_kmers{}", this->m_output, ext);
 
@@ -268,6 +328,9 @@ namespace kmdiff {
                                           control_out,
                                           "control",
                                           this->m_kff,
+                                          this->m_kff_data,
+                                          this->m_gzip,
+                                          cpr_threads,
                                           this->m_config,
                                           std::ref(this->m_control_count));
 
@@ -276,9 +339,15 @@ namespace kmdiff {
                                        case_out,
                                        "case",
                                        this->m_kff,
+                                       this->m_kff_data,
+                                       this->m_gzip,
+                                       cpr_threads,
                                        this->m_config,
                                        std::ref(this->m_case_count));
 
+        BatchProducer<ks_type> controls(controls_queue);
+        BatchProducer<ks_type> cases(cases_queue);
+
         std::size_t c = m_pqueue.size() / nb_part;
 
         std::size_t i = 0;
@@ -292,11 +361,11 @@ namespace kmdiff {
 
           if (ks.m_sign == Significance::CONTROL)
           {
-            controls_queue.push(std::move(ks));
+            controls.push(std::move(ks));
           }
           else
           {
-            cases_queue.push(std::move(ks));
+            cases.push(std::move(ks));
           }
 
           if (this->m_pb)
@@ -314,8 +383,8 @@ namespace kmdiff {
           this->m_pb->set_progress(nb_part);
         }
 
-        controls_queue.end_signal();
-        cases_queue.end_signal();
+        controls.finish();
+        cases.finish();
 
         control_writer.join();
         case_writer.join();
@@ -347,6 +416,8 @@ namespace kmdiff {
       kmtricks_config_t config,
       const std::string& out,
       bool kff,
+      bool kff_data,
+      bool gzip,
       std::size_t threads,
       pb_t pb)
   {
@@ -355,10 +426,10 @@ namespace kmdiff {
       case CorrectionType::NOTHING:
       case CorrectionType::BONFERRONI:
       case CorrectionType::SIDAK:
-        return std::make_unique<aggregator<KSIZE>>(accs, corrector, config, out, kff, threads, pb);
+        return std::make_unique<aggregator<KSIZE>>(accs, corrector, config, out, kff, kff_data, gzip, threads, pb);
       case CorrectionType::BENJAMINI:
       case CorrectionType::HOLM:
-        return std::make_unique<sorted_aggregator<KSIZE>>(accs, corrector, config, out, kff, threads, pb);
+        return std::make_unique<sorted_aggregator<KSIZE>>(accs, corrector, config, out, kff, kff_data, gzip, threads, pb);
       default:
         return nullptr;
     }
@@ -0,0 +1,246 @@
+/*****************************************************************************
+ *   kmdiff
+ *   Authors: T. Lemane
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+#pragma once
+
+// std
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace kmdiff {
+
+  /*
+    Bounded multi-producer/multi-consumer queue of batches. Elements are moved by batches of
+    batch_size elements, the capacity is derived from a memory budget in bytes, and the ring is
+    lock-free (Vyukov's bounded MPMC queue). Threads only sleep on a condition variable when the
+    ring stays full/empty after spinning.
+  */
+  template <typename T>
+  class BatchQueue
+  {
+    struct cell
+    {
+      std::atomic<std::size_t> seq;
+      std::vector<T> data;
+    };
+
+    static constexpr std::size_t s_spin = 64;
+
+   public:
+    using batch_type = std::vector<T>;
+
+    BatchQueue() = delete;
+    BatchQueue(const BatchQueue&) = delete;
+    BatchQueue(BatchQueue&&) = delete;
+    BatchQueue& operator=(const BatchQueue&) = delete;
+    BatchQueue& operator=(BatchQueue&&) = delete;
+
+    BatchQueue(std::size_t max_bytes, std::size_t batch_size, std::size_t nb_producers)
+      : m_batch_size(batch_size ? batch_size : 1), m_nb_producers(nb_producers)
+    {
+      std::size_t n = max_bytes / (m_batch_size * sizeof(T));
+      m_capacity = 2;
+      while (m_capacity < n) m_capacity <<= 1;
+      m_mask = m_capacity - 1;
+
+      m_cells = std::make_unique<cell[]>(m_capacity);
+      for (std::size_t i = 0; i < m_capacity; i++)
+        m_cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    std::size_t batch_size() const { return m_batch_size; }
+
+    void push(batch_type&& batch)
+    {
+      for (std::size_t i = 0; !try_push(batch); i++)
+      {
+        if (i < s_spin)
+          std::this_thread::yield();
+        else
+          wait(m_not_full, m_waiting_push);
+      }
+      notify(m_not_empty, m_waiting_pop);
+    }
+
+    bool pop(batch_type& batch)
+    {
+      for (std::size_t i = 0; !try_pop(batch); i++)
+      {
+        if (m_ended.load(std::memory_order_acquire) == m_nb_producers)
+          return try_pop(batch);
+
+        if (i < s_spin)
+          std::this_thread::yield();
+        else
+          wait(m_not_empty, m_waiting_pop);
+      }
+      notify(m_not_full, m_waiting_push);
+      return true;
+    }
+
+    // called once by each producer
+    void end_signal()
+    {
+      m_ended.fetch_add(1, std::memory_order_acq_rel);
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_not_empty.notify_all();
+    }
+
+   private:
+    bool try_push(batch_type& batch)
+    {
+      std::size_t pos = m_tail.load(std::memory_order_relaxed);
+      while (true)
+      {
+        cell& c = m_cells[pos & m_mask];
+        std::size_t seq = c.seq.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+        if (diff == 0)
+        {
+          if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            c.data.swap(batch);
+            c.seq.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (diff < 0)
+          return false;
+        else
+          pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+
+    bool try_pop(batch_type& batch)
+    {
+      std::size_t pos = m_head.load(std::memory_order_relaxed);
+      while (true)
+      {
+        cell& c = m_cells[pos & m_mask];
+        std::size_t seq = c.seq.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+        if (diff == 0)
+        {
+          if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          {
+            batch.swap(c.data);
+            c.data.clear();
+            c.seq.store(pos + m_mask + 1, std::memory_order_release);
+            return true;
+          }
+        }
+        else if (diff < 0)
+          return false;
+        else
+          pos = m_head.load(std::memory_order_relaxed);
+      }
+    }
+
+    // slow path, the timeout covers a notification sent between the last try and the wait
+    void wait(std::condition_variable& cv, std::atomic<std::size_t>& waiting)
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      waiting.fetch_add(1, std::memory_order_acq_rel);
+      cv.wait_for(lock, std::chrono::milliseconds(1));
+      waiting.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void notify(std::condition_variable& cv, std::atomic<std::size_t>& waiting)
+    {
+      if (waiting.load(std::memory_order_acquire))
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        cv.notify_one();
+      }
+    }
+
+   private:
+    std::size_t m_batch_size {1};
+    std::size_t m_nb_producers {0};
+    std::size_t m_capacity {0};
+    std::size_t m_mask {0};
+
+    std::unique_ptr<cell[]> m_cells {nullptr};
+
+    alignas(64) std::atomic<std::size_t> m_tail {0};
+    alignas(64) std::atomic<std::size_t> m_head {0};
+    alignas(64) std::atomic<std::size_t> m_ended {0};
+
+    std::atomic<std::size_t> m_waiting_push {0};
+    std::atomic<std::size_t> m_waiting_pop {0};
+
+    std::mutex m_mutex;
+    std::condition_variable m_not_full;
+    std::condition_variable m_not_empty;
+  };
+
+  // Per-producer buffer, fills a batch locally and pushes it when full.
+  template <typename T>
+  class BatchProducer
+  {
+   public:
+    BatchProducer(BatchQueue<T>& queue) : m_queue(queue)
+    {
+      m_batch.reserve(m_queue.batch_size());
+    }
+
+    BatchProducer(const BatchProducer&) = delete;
+    BatchProducer& operator=(const BatchProducer&) = delete;
+
+    ~BatchProducer() { finish(); }
+
+    void push(T&& e)
+    {
+      m_batch.push_back(std::move(e));
+      if (m_batch.size() == m_queue.batch_size())
+        flush();
+    }
+
+    void finish()
+    {
+      if (m_finished)
+        return;
+      flush();
+      m_queue.end_signal();
+      m_finished = true;
+    }
+
+   private:
+    void flush()
+    {
+      if (m_batch.empty())
+        return;
+      m_queue.push(std::move(m_batch));
+      m_batch.reserve(m_queue.batch_size());
+    }
+
+   private:
+    BatchQueue<T>& m_queue;
+    typename BatchQueue<T>::batch_type m_batch;
+    bool m_finished {false};
+  };
+
+}  // end of namespace kmdiff
@@ -0,0 +1,82 @@
+/*****************************************************************************
+ *   kmdiff
+ *   Authors: T. Lemane
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+// int
+#include <kmdiff/threadpool.hpp>
+
+namespace kmdiff {
+
+  /*
+    Multithreaded BGZF writer: data is cut into blocks of at most 0xff00 bytes, each block is
+    compressed as an independent gzip member (with the BGZF 'BC' extra field) by a pool of
+    threads, and written in order. The output is a regular multi-member gzip file readable by
+    gzip/zcat, and by htslib as BGZF.
+  */
+  class BgzfWriter
+  {
+    using block_t = std::vector<uint8_t>;
+
+   public:
+    static constexpr std::size_t block_size = 0xff00;
+
+    BgzfWriter(const std::string& path, std::size_t nb_threads = 1, int level = -1);
+
+    BgzfWriter() = delete;
+    BgzfWriter(const BgzfWriter&) = delete;
+    BgzfWriter& operator=(const BgzfWriter&) = delete;
+
+    ~BgzfWriter();
+
+    void write(const char* data, std::size_t size);
+
+    void write(const std::string& str) { write(str.data(), str.size()); }
+
+    // Must be called once everything is written, the destructor does not finish the file.
+    void close();
+
+   private:
+    void submit();
+    void write_front();
+
+    static block_t compress(const block_t& in, int level);
+
+   private:
+    std::string m_path;
+    std::FILE* m_out {nullptr};
+    int m_level {-1};
+    std::size_t m_max_inflight {1};
+
+    block_t m_buffer;
+    std::deque<std::future<block_t>> m_inflight;
+    std::unique_ptr<ThreadPool> m_pool {nullptr};
+  };
+
+  using bgzf_w_t = std::unique_ptr<BgzfWriter>;
+
+} // end of namespace kmdiff
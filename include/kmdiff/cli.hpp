@@ -47,6 +47,7 @@ namespace kmdiff {
   private:
     cli_t cli {nullptr};
     diff_options_t diff_opt {nullptr};
+    diff_options_t diff_merge_opt {nullptr};
     count_options_t count_opt {nullptr};
   };
 
@@ -39,4 +39,6 @@ namespace kmdiff {
 
   kmdiff_options_t diff_cli(std::shared_ptr<bc::Parser<1>> cli, diff_options_t options);
 
+  kmdiff_options_t diff_merge_cli(std::shared_ptr<bc::Parser<1>> cli, diff_options_t options);
+
 } // end of namespace kmdiff
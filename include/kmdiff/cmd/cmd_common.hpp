@@ -29,6 +29,7 @@ namespace kmdiff {
   enum class COMMAND
   {
     DIFF,
+    DIFF_MERGE,
     COUNT,
     INFOS,
     POPSIM,
@@ -23,6 +23,7 @@
 #include <memory>
 #include <thread>
 #include <string>
+#include <tuple>
 #include <vector>
 
 // ext
@@ -39,6 +40,7 @@
 #include <kmdiff/cmd/diff_opt.hpp>
 #include <kmdiff/time.hpp>
 #include <kmdiff/corrector.hpp>
+#include <kmdiff/shard.hpp>
 
 #ifdef WITH_PLUGIN
   #include <kmdiff/model_manager.hpp>
@@ -63,12 +65,74 @@ namespace kmdiff {
     fs::copy(from + "/kmtricks.fof", to, coptions);
   }
 
+  // P-value up to which the merge keeps k-mers. With --retain, it keeps every k-mer up to the
+  // retention level, so that runs with a lower threshold/cutoff read their k-mers from it. The
+  // fused mode corrects p-values during the merge and does not retain. The level is recorded in
+  // the merge manifest, see main_diff.
+  inline double merge_level(diff_options_t opt, bool fused)
+  {
+    double level = opt->threshold / opt->cutoff;
+    return opt->retain > 0 && !fused ? std::max(opt->retain, level) : level;
+  }
+
+  // Uncorrected partition of the merge. With --retain, it is sorted by p-value and kept, and only
+  // the k-mers below the threshold/cutoff of this run are read.
+  template<std::size_t KSIZE>
+  acc_t<KmerSign<KSIZE>> merge_accumulator(const std::string& path,
+                                           bool read,
+                                           diff_options_t opt,
+                                           const kmtricks_config_t& config)
+  {
+    bool retain = opt->retain > 0;
+
+    acc_t<KmerSign<KSIZE>> acc = std::make_shared<FileAccumulator<KmerSign<KSIZE>>>(
+      path, config.kmer_size, read, !opt->keep_tmp && !retain);
+
+    if (!retain)
+      return acc;
+
+    if (!read)
+    {
+      // Sorted through bounded runs spilled next to the partition, the merge workers sort their
+      // partitions concurrently.
+      acc = std::make_shared<SortedAccumulator<KmerSign<KSIZE>>>(acc,
+        [](const KmerSign<KSIZE>& a, const KmerSign<KSIZE>& b) { return a.m_pvalue < b.m_pvalue; },
+        path, config.kmer_size);
+    }
+
+    double level = opt->threshold / opt->cutoff;
+    return std::make_shared<PrefixAccumulator<KmerSign<KSIZE>>>(acc,
+      [level](const KmerSign<KSIZE>& ks) { return ks.m_pvalue <= level; });
+  }
+
+  // Significant k-mers of a retained partition, by sign, for this run's threshold/cutoff.
+  template<std::size_t KSIZE>
+  std::tuple<std::size_t, std::size_t> retained_signs(const std::string& path,
+                                                      diff_options_t opt,
+                                                      const kmtricks_config_t& config)
+  {
+    std::size_t controls = 0, cases = 0;
+    acc_t<KmerSign<KSIZE>> acc = merge_accumulator<KSIZE>(path, true, opt, config);
+    while (auto& o = acc->get())
+    {
+      if (o->m_sign == Significance::CONTROL)
+        controls++;
+      else
+        cases++;
+    }
+    return std::make_tuple(controls, cases);
+  }
+
   template<std::size_t KSIZE>
   std::size_t do_diff(diff_options_t opt,
                const kmtricks_config_t& config,
                const std::string& output_part_dir,
                std::vector<acc_t<KmerSign<KSIZE>>>& accumulators,
-               std::shared_ptr<Sampler<DMAX_C>> sampler)
+               std::shared_ptr<Sampler<DMAX_C>> sampler,
+               manifest_t manifest = nullptr,
+               std::vector<std::uint8_t> skip = {},
+               pop_strat_corrector_t pop = nullptr,
+               bool sampling_only = false)
   {
     Timer merge_time;
 
@@ -89,10 +153,7 @@ namespace kmdiff {
 
     if (matrix_paths.empty())
     {
-      for (std::size_t i = 0; i < config.nb_partitions; i++)
-      {
-        part_paths.push_back(km::KmDir::get().get_files_to_merge(i, true, km::KM_FILE::KMER));
-      }
+      part_paths = get_partition_paths(opt->kmtricks_dirs, config.nb_partitions);
     }
     else
     {
@@ -100,15 +161,35 @@ namespace kmdiff {
       std::ofstream out_opt_c(km::KmDir::get().m_root + "/kmdiff-count.opt");
     }
 
-    for (std::size_t i = 0; i < accumulators.size(); i++)
+    // The sampled k-mers must come from every partition.
+    skip.resize(accumulators.size(), 0);
+    if (sampler)
+    {
+      std::fill(skip.begin(), skip.end(), 0);
+      if (manifest)
+        manifest->reset();
+    }
+
+    // In fused popstrat mode, the k-mers are corrected during the merge and the partitions are
+    // the ones of do_pop. A sampling only pass writes nothing. Skipped partitions are read back
+    // when they are done, and are not needed otherwise.
+    for (std::size_t i = 0; i < accumulators.size() && !sampling_only; i++)
     {
-      accumulators[i] = std::make_shared<FileAccumulator<KmerSign<KSIZE>>>(
-        fmt::format("{}/p{}_uncorrected", output_part_dir, i), config.kmer_size, false, !opt->keep_tmp);
+      if (skip[i] && !manifest->done(i))
+        continue;
+
+      if (pop)
+        accumulators[i] = std::make_shared<FileAccumulator<KmerSign<KSIZE>>>(
+          fmt::format("{}/p{}_popstrat_uncorrected", output_part_dir, i), config.kmer_size,
+          skip[i], !opt->keep_tmp);
+      else
+        accumulators[i] = merge_accumulator<KSIZE>(
+          fmt::format("{}/p{}_uncorrected", output_part_dir, i), skip[i], opt, config);
     }
 
     std::vector<std::uint32_t> ab_mins(opt->nb_controls + opt->nb_cases, 1);
 
-    auto [total_controls, total_cases] = get_total_kmer(opt->kmtricks_dir, opt->nb_controls, opt->nb_cases, config.abundance_min);
+    auto [total_controls, total_cases] = get_total_kmer(opt->kmtricks_dirs, opt->nb_controls, opt->nb_cases);
 
     spdlog::debug("\nNb k-mers controls: {}\n Nb k-mers cases: {}",
                   str_vector(total_controls),
@@ -136,15 +217,38 @@ namespace kmdiff {
 
     std::string sign_matrix_dir = fmt::format("{}/positive_kmer_matrix", opt->output_directory);
 
-    if (opt->save_sk)
+    if (opt->save_sk && !sampling_only)
     {
       copy_kdir(km::KmDir::get().m_root, sign_matrix_dir);
+
+      // The matrix holds the samples of every run, in the order of the runs.
+      if (opt->kmtricks_dirs.size() > 1)
+      {
+        fof_path(opt->kmtricks_dirs, sign_matrix_dir);
+        options_path(opt->kmtricks_dirs, sign_matrix_dir);
+      }
       sign_matrix_dir += "/matrices";
     }
 
     global_merge<KSIZE, DMAX_C> merger(
       part_paths, ab_mins, model, accumulators, config.kmer_size, opt->nb_controls,
-      opt->nb_cases, opt->threshold/opt->cutoff, opt->nb_threads, sampler, opt->save_sk ? sign_matrix_dir : std::string(""));
+      opt->nb_cases, merge_level(opt, pop != nullptr), opt->nb_threads, sampler,
+      opt->save_sk && !sampling_only ? sign_matrix_dir : std::string(""));
+
+    merger.set_checkpoint(manifest, skip, opt->retain > 0 && pop == nullptr);
+    merger.set_significance(opt->threshold / opt->cutoff);
+    merger.set_pin_threads(opt->pin_threads);
+
+    if (!from_matrix)
+    {
+      merger.set_partition_sizes(get_partition_sizes(opt->kmtricks_dirs));
+      merger.set_partition_check([opt](std::size_t p) { check_partition(opt->kmtricks_dirs, p); });
+    }
+
+    #ifdef WITH_POPSTRAT
+      merger.set_pop_corrector(pop);
+      merger.set_sampling_only(sampling_only);
+    #endif
 
     std::size_t total_kmers = 0;
 
@@ -154,78 +258,178 @@ namespace kmdiff {
       total_kmers = merger.merge();
 
     auto [sign_controls, sign_cases] = merger.signs();
+    std::size_t nb_sign = merger.nb_sign();
+    std::size_t nb_reused = 0;
+
+    for (std::size_t i = 0; i < skip.size(); i++)
+    {
+      if (!skip[i] || !manifest->get(i))
+        continue;
+
+      const auto& e = manifest->get(i).value();
+      total_kmers += e.total;
+      nb_sign += e.kmers;
+      nb_reused++;
+
+      // A retained partition may come from a run with another threshold/cutoff, its significant
+      // k-mers are the prefix read by this run.
+      auto [co, ca] = e.sorted
+        ? retained_signs<KSIZE>(fmt::format("{}/p{}_uncorrected", output_part_dir, i), opt, config)
+        : std::make_tuple(e.controls, e.cases);
+      sign_controls += co;
+      sign_cases += ca;
+    }
 
     spdlog::info("Partitions processed ({})", merge_time.formatted());
 
-    spdlog::info("{}/{} significant k-mers.", merger.nb_sign(), total_kmers);
+    if (nb_reused)
+      spdlog::info("{}/{} partitions reused from a previous run.", nb_reused, skip.size());
+
+    if (sampling_only)
+      return total_kmers;
+
+    if (merge_level(opt, pop != nullptr) > opt->threshold / opt->cutoff)
+      spdlog::info("{}/{} k-mers retained (p-value <= {}).", nb_sign, total_kmers, merge_level(opt, false));
+    else
+      spdlog::info("{}/{} significant k-mers.", nb_sign, total_kmers);
     spdlog::info("Before correction: {} (control), {} (case).", sign_controls, sign_cases);
 
     return total_kmers;
   }
 
   #ifdef WITH_POPSTRAT
-  template<std::size_t KSIZE>
-    void do_pop(std::vector<acc_t<KmerSign<KSIZE>>>& accumulators,
-                const std::string& pop_dir,
-                const std::string& output_part_dir,
-                diff_options_t opt,
-                const kmtricks_config_t& config)
-    {
-      Timer pca_time;
+  // Computes the principal components if they are not cached yet, and returns a corrector ready
+  // to be applied.
+  inline pop_strat_corrector_t make_pop_corrector(const std::string& pop_dir,
+                                                  const std::string& pcs_path,
+                                                  diff_options_t opt,
+                                                  const kmtricks_config_t& config)
+  {
+    Timer pca_time;
 
-      std::vector<acc_t<KmerSign<KSIZE>>> pop_accumulators;
+    std::string gwas_eigenstratX_geno = fmt::format("{}/gwas_eigenstratX.geno", pop_dir);
+    std::string gwas_eigenstratX_ind = fmt::format("{}/gwas_eigenstratX.ind", pop_dir);
+    std::string gwas_eigenstratX_total = fmt::format("{}/gwas_eigenstratX.total", pop_dir);
 
-      std::string gwas_eigenstratX_ind = fmt::format("{}/gwas_eigenstratX.ind", pop_dir);
-      std::string gwas_eigenstratX_total = fmt::format("{}/gwas_eigenstratX.total", pop_dir);
-      std::string pcs_evec = fmt::format("{}/pcs.evec", pop_dir);
+    std::string gwas_info_path = fmt::format("{}/gwas_infos.txt", pop_dir);
+    std::string fof = fof_path(opt->kmtricks_dirs, opt->output_directory);
 
-      std::string parfile_path = fmt::format("{}/parfile.txt", pop_dir);
-      std::string gwas_info_path = fmt::format("{}/gwas_infos.txt", pop_dir);
-      std::string fof = fmt::format("{}/kmtricks.fof", opt->kmtricks_dir);
+    auto [total_controls, total_cases] = get_total_kmer(opt->kmtricks_dirs, opt->nb_controls, opt->nb_cases);
 
-      auto [total_controls, total_cases] = get_total_kmer(opt->kmtricks_dir, opt->nb_controls, opt->nb_cases, config.abundance_min);
+    write_gwas_info(fof, gwas_info_path, opt->nb_controls, opt->nb_cases, opt->gender);
+    write_gwas_info(fof, gwas_eigenstratX_ind, opt->nb_controls, opt->nb_cases, opt->gender);
+    write_gwas_eigenstrat_total(gwas_eigenstratX_total, total_controls, total_cases);
 
-      write_parfile(parfile_path);
-      write_gwas_info(fof, gwas_info_path, opt->nb_controls, opt->nb_cases, opt->gender);
-      write_gwas_info(fof, gwas_eigenstratX_ind, opt->nb_controls, opt->nb_cases, opt->gender);
-      write_gwas_eigenstrat_total(gwas_eigenstratX_total, total_controls, total_cases);
+    if (!fs::exists(pcs_path))
+    {
+      geno_matrix geno(gwas_eigenstratX_geno, opt->nb_controls + opt->nb_cases);
+      spdlog::info("PCA on {} k-mers...", geno.rows());
+      randomized_pca pca(geno, opt->ploidy, opt->nb_threads);
+      pca_result pcs = pca.run(pop_strat_corrector::s_pca_count, opt->seed);
 
-      std::string log_eigenstrat = "eigenstrat.log";
-      run_eigenstrat_smartpca(
-        pop_dir, "parfile.txt", log_eigenstrat, opt->is_diploid, opt->nb_controls + opt->nb_cases);
+      fs::create_directories(fs::path(pcs_path).parent_path());
+      write_evec(pcs_path, pcs);
 
       spdlog::info("PCA done. ({}).", pca_time.formatted());
+    }
+    else
+    {
+      spdlog::info("Reuse principal components from {}.", pcs_path);
+    }
+
+    auto pop_corrector = std::make_shared<pop_strat_corrector>(
+      opt->nb_controls, opt->nb_cases, total_controls, total_cases, opt->npc);
+
+    pop_corrector->load_Z(pcs_path);
+    pop_corrector->load_Y(gwas_eigenstratX_ind);
+    pop_corrector->load_C(opt->covariates);
+    pop_corrector->load_ginfo(gwas_info_path);
+    pop_corrector->init_global_features();
+
+    return pop_corrector;
+  }
+
+  template<std::size_t KSIZE>
+    void do_pop(std::vector<acc_t<KmerSign<KSIZE>>>& accumulators,
+                const std::string& pop_dir,
+                const std::string& output_part_dir,
+                const std::string& pcs_path,
+                manifest_t manifest,
+                diff_options_t opt,
+                const kmtricks_config_t& config)
+    {
+      auto pop_corrector = make_pop_corrector(pop_dir, pcs_path, opt, config);
 
       Timer pop_time;
 
       spdlog::info("Apply population stratification correction...");
-      auto pop_corrector = std::make_shared<pop_strat_corrector>(
-        opt->nb_controls, opt->nb_cases, total_controls, total_cases, opt->npc);
 
-      pop_corrector->load_Z(pcs_evec);
-      pop_corrector->load_Y(gwas_eigenstratX_ind);
-      pop_corrector->load_C(opt->covariates);
-      pop_corrector->load_ginfo(gwas_info_path);
-      pop_corrector->init_global_features();
-
-      pop_accumulators.resize(accumulators.size());
+      std::vector<acc_t<KmerSign<KSIZE>>> pop_accumulators(accumulators.size());
 
       for (std::size_t p = 0; p < accumulators.size(); p++)
       {
+        if (!accumulators[p] && !manifest->done(p))
+          continue;
+
         pop_accumulators[p] = std::make_shared<FileAccumulator<KmerSign<KSIZE>>>(
-          fmt::format("{}/p{}_popstrat_uncorrected", output_part_dir, p), config.kmer_size, false, !opt->keep_tmp);
+          fmt::format("{}/p{}_popstrat_uncorrected", output_part_dir, p), config.kmer_size,
+          manifest->done(p), !opt->keep_tmp);
       }
 
-      pop_corrector->apply(accumulators, pop_accumulators, opt->nb_threads);
+      pop_corrector->apply(accumulators, pop_accumulators, opt->nb_threads, manifest, opt->pin_threads);
 
       accumulators.swap(pop_accumulators);
 
       spdlog::info("Population correction done. ({}).", pop_time.formatted());
     }
+
+  /*
+    Fused mode: the significant k-mers are corrected while they are merged, so that they are
+    written and read once instead of three times. When the principal components are not cached,
+    a first merge only samples the k-mers for the PCA.
+  */
+  template<std::size_t KSIZE>
+    std::size_t do_fused_pop(std::vector<acc_t<KmerSign<KSIZE>>>& accumulators,
+                             const std::string& pop_dir,
+                             const std::string& output_part_dir,
+                             const std::string& pcs_path,
+                             const std::vector<std::string>& individuals,
+                             const std::vector<std::uint8_t>& outside,
+                             manifest_t manifest,
+                             diff_options_t opt,
+                             const kmtricks_config_t& config)
+    {
+      if (!fs::exists(pcs_path))
+      {
+        spdlog::info("Sample k-mers for the PCA...");
+
+        auto sampler = std::make_shared<Sampler<DMAX_C>>(
+          fmt::format("{}/gwas_eigenstratX.geno", pop_dir),
+          fmt::format("{}/gwas_eigenstratX.snp", pop_dir),
+          individuals, config.nb_partitions, opt->kmer_pca, opt->seed, opt->pca_text);
+
+        std::vector<acc_t<KmerSign<KSIZE>>> none(accumulators.size());
+        do_diff<KSIZE>(opt, config, output_part_dir, none, sampler, nullptr, {}, nullptr, true);
+        sampler->close();
+      }
+
+      auto pop_corrector = make_pop_corrector(pop_dir, pcs_path, opt, config);
+
+      spdlog::info("Apply population stratification correction during the merge...");
+      std::vector<std::uint8_t> skip(accumulators.size(), 0);
+      for (std::size_t i = 0; i < skip.size(); i++)
+        skip[i] = outside[i] || manifest->done(i);
+
+      std::size_t total_kmers = do_diff<KSIZE>(
+        opt, config, output_part_dir, accumulators, nullptr, manifest, skip, pop_corrector);
+
+      return total_kmers;
+    }
   #endif
 
   template<std::size_t KSIZE>
   void do_correction(std::vector<acc_t<KmerSign<KSIZE>>>& accumulators,
+                     manifest_t manifest,
                      diff_options_t opt,
                      const kmtricks_config_t& config,
                      std::size_t total_kmers)
@@ -248,12 +452,16 @@ namespace kmdiff {
 
     auto corrector = make_corrector(opt->correction, opt->threshold, total_kmers);
     auto agg = make_aggregator<KSIZE>(
-        accumulators, corrector, config, opt->output_directory, opt->kff, opt->nb_threads, pb);
+        accumulators, corrector, config, opt->output_directory, opt->kff, opt->kff_data,
+        opt->gzip, opt->nb_threads, pb);
 
     agg->run();
 
     auto [c_controls, c_cases] = agg->counts();
 
+    manifest->commit(0, {c_controls, total_kmers, c_controls, 0, 0});
+    manifest->commit(1, {c_cases, total_kmers, 0, c_cases, 0});
+
     delete pb;
     spdlog::info("Partitions aggregated ({})", agg_time.formatted());
     spdlog::info("Significant k-mers: {} (control), {} (case).", c_controls, c_cases);
@@ -265,110 +473,398 @@ namespace kmdiff {
     diff_options_t opt = std::static_pointer_cast<struct diff_options>(options);
     spdlog::debug(opt->display());
 
+    if (opt->kff_data && !opt->kff)
+      throw ConfigError("--kff-data requires -f/--kff-output.");
+
+    if (opt->gzip && opt->kff)
+      throw ConfigError("-z/--gzip-output cannot be used with -f/--kff-output.");
+
+    run_manifest::s_nb_threads = opt->nb_threads;
+
     #ifdef WITH_PLUGIN
       if (!opt->model_lib_path.empty())
         plugin_manager<IModel<DMAX_C>>::get().init(opt->model_lib_path, opt->model_config);
     #endif
 
     Timer whole_time;
-    km::KmDir::get().init(opt->kmtricks_dir, fmt::format("{}/kmtricks.fof", opt->kmtricks_dir));
-    kmtricks_config_t config = get_kmtricks_config(opt->kmtricks_dir);
+    bind_run(opt->kmtricks_dir);
+    kmtricks_config_t config = get_kmtricks_config(opt->kmtricks_dirs);
     km::Kmer<KSIZE>::m_kmer_size = config.kmer_size;
 
-    bool prev_run = fs::exists(fmt::format("{}/options.bin", opt->output_directory));
-    diff_options_t prev_opt = nullptr;
-
-    bool prev_1 = false;
-    bool prev_2 = false;
-    bool prev_f = false;
-    unsigned action = 0;
-
     std::string output_part_dir = fmt::format("{}/partitions", opt->output_directory);
     fs::create_directories(output_part_dir);
 
-    if (prev_run)
+    // options.bin of older builds is unversioned and no longer read, the stage keys replace it.
+    // It is removed so that an older build cannot load fields it did not write.
+    fs::remove(fmt::format("{}/options.bin", opt->output_directory));
+
+    // With --partitions or --shard, the run only processes a range of partitions and ends with a
+    // shard descriptor instead of the outputs. Shards have their own manifests, and their
+    // partitions are kept for diff-merge.
+    if (!opt->partitions.empty() && !opt->shard.empty())
+      throw ConfigError("--partitions and --shard are mutually exclusive.");
+
+    bool sharded = !opt->partitions.empty() || !opt->shard.empty();
+    std::size_t first = 0, last = config.nb_partitions;
+
+    if (!opt->partitions.empty())
+      std::tie(first, last) = parse_partitions(opt->partitions, config.nb_partitions);
+    else if (!opt->shard.empty())
+      std::tie(first, last) = parse_shard(opt->shard, config.nb_partitions);
+
+    std::vector<std::uint8_t> outside(config.nb_partitions, 1);
+    std::fill(outside.begin() + first, outside.begin() + last, 0);
+    std::string tag = sharded ? fmt::format(".{}-{}", first, last - 1) : "";
+
+    if (sharded)
     {
-      prev_opt = load_opt(fmt::format("{}/options.bin", opt->output_directory));
-      spdlog::debug(fmt::format("Previous {}", prev_opt->display()));
-      action = compare_opt(opt, prev_opt);
-      prev_1 = partitions_exist("{}/p{}_uncorrected", config.nb_partitions, output_part_dir);
-      prev_2 = partitions_exist("{}/p{}_popstrat_uncorrected", config.nb_partitions, output_part_dir);
-      prev_f = fs::exists(fmt::format("{}/control_kmers.fasta", opt->output_directory)) &&
-               fs::exists(fmt::format("{}/case_kmers.fasta", opt->output_directory));
-
-      spdlog::debug("prev1 -> {}", prev_1);
-      spdlog::debug("prev2 -> {}", prev_2);
-      spdlog::debug("prevf -> {}", prev_f);
-      spdlog::debug("action -> {}", action);
+      opt->keep_tmp = true;
+      spdlog::info("Shard {}-{} of {} partitions.", first, last - 1, config.nb_partitions);
     }
 
-    eig_geno_t<DMAX_C> geno {nullptr};
-    eig_snp_t snp {nullptr};
     std::shared_ptr<Sampler<DMAX_C>> sampler {nullptr};
 
+    std::uint64_t run = run_key(opt->kmtricks_dirs);
+    spdlog::debug("run -> {:016x}", run);
+
     std::string pop_dir;
+    std::string pcs_path;
+    std::vector<std::string> individuals;
 
     if (opt->pop_correction)
     {
       pop_dir = fmt::format("{}/popstrat", opt->output_directory);
-      fs::create_directory(pop_dir);
+      std::string pop_root = pop_dir;
+      if (sharded)
+        pop_dir = fmt::format("{}/shard{}", pop_root, tag);
+      fs::create_directories(pop_dir);
+
+      km::Fof fof(fof_path(opt->kmtricks_dirs, opt->output_directory));
+      for (std::size_t i = 0; i < opt->nb_controls + opt->nb_cases; i++)
+        individuals.push_back(fof.get_id(i));
+
+      // Principal components are cached by content key in popstrat/pcs, unless they are given.
+      if (!opt->pcs.empty())
+      {
+        pcs_path = opt->pcs;
+      }
+      else
+      {
+        auto [total_controls, total_cases] = get_total_kmer(
+          opt->kmtricks_dirs, opt->nb_controls, opt->nb_cases);
+        pcs_path = fmt::format("{}/pcs/{:016x}.evec", pop_root, pca_key(
+          run, individuals, total_controls, total_cases, opt->kmer_pca, opt->seed, opt->ploidy));
+      }
+
+      // The PCA samples k-mers from every partition.
+      if (sharded && !fs::exists(pcs_path))
+        throw ConfigError(fmt::format(
+          "--pop-correction with a shard needs principal components, give them with --pcs or "
+          "compute them first (expected {}).", pcs_path));
+
+      spdlog::debug("pcs -> {}", pcs_path);
     }
 
-    bool redo_c = false;
-    std::vector<acc_t<KmerSign<KSIZE>>> accumulators(config.nb_partitions);
+    #ifdef WITH_POPSTRAT
+      pop_strat_corrector::set_params(opt->max_iteration,
+                                      opt->learning_rate,
+                                      opt->epsilon,
+                                      opt->stand,
+                                      opt->irls);
+      pop_strat_corrector::set_test(opt->pop_test, opt->pop_refit, opt->threshold);
 
-    if (!prev_1 || (action & 0b1))
-    {
-      std::string gwas_eigenstratX_geno = fmt::format("{}/gwas_eigenstratX.geno", pop_dir);
-      std::string gwas_eigenstratX_snp = fmt::format("{}/gwas_eigenstratX.snp", pop_dir);
+      bool fused = opt->pop_correction && opt->pop_fused && opt->model_lib_path.empty();
+    #else
+      bool fused = false;
+    #endif
 
-      if (opt->pop_correction)
+    // Each stage commits its outputs to a manifest, keyed by a hash of the inputs and parameters
+    // they depend on, so that a run only redoes the outputs which are missing, corrupt or stale.
+    stage_key merge_key("merge-v3");
+    merge_key.add(run)
+             .add(sizeof(kmer_count_t))
+             .add(opt->nb_controls)
+             .add(opt->nb_cases)
+             .add(opt->log_size)
+             .add(opt->save_sk)
+             // the sign matrix holds the k-mers up to the threshold/cutoff
+             .add(opt->save_sk ? opt->threshold / opt->cutoff : 0.0)
+             .add_file(opt->model_lib_path)
+             .add_file(opt->model_config);
+
+    auto merge_manifest = std::make_shared<partition_manifest>(
+      fmt::format("{}/uncorrected{}.manifest", output_part_dir, tag), merge_key.str(),
+      partition_paths("{}/p{}_uncorrected", config.nb_partitions, output_part_dir));
+
+    // The level of the merge is recorded with its partitions rather than in the key. A retained
+    // merge serves any run with a threshold/cutoff up to its level, without repeating --retain,
+    // and the partitions kept at another level are redone.
+    if (!fused)
+    {
+      for (std::size_t i = first; i < last; i++)
       {
-        geno = std::make_shared<EigGenoFile<DMAX_C>>(gwas_eigenstratX_geno);
-        snp = std::make_shared<EigSnpFile>(gwas_eigenstratX_snp);
-        sampler = std::make_shared<Sampler<DMAX_C>>(geno, snp, opt->kmer_pca, opt->seed);
+        const auto& e = merge_manifest->get(i);
+        if (merge_manifest->done(i) && e->sorted && e->level >= opt->threshold / opt->cutoff)
+          opt->retain = std::max(opt->retain, e->level);
       }
+    }
+
+    double level = merge_level(opt, fused);
+    bool sorted = opt->retain > 0 && !fused;
+    merge_manifest->keep_if([level, sorted](const partition_manifest::entry& e) {
+      return sorted ? e.sorted && e.level >= level : !e.sorted && e.level == level;
+    });
+
+    stage_key pop_key("popstrat-v1");
+    manifest_t pop_manifest {nullptr};
+
+    if (opt->pop_correction)
+    {
+      // Cached pcs are named by content, given ones are hashed.
+      pop_key.add(merge_key.value())
+             .add(opt->threshold / opt->cutoff)
+             .add(fused)
+             .add(pcs_path)
+             .add_file(opt->pcs)
+             .add(opt->npc)
+             .add(pop_test_str(opt->pop_test))
+             .add(opt->pop_refit)
+             .add(opt->threshold)
+             .add(opt->learning_rate)
+             .add(opt->max_iteration)
+             .add(opt->epsilon)
+             .add(opt->stand)
+             .add(opt->irls)
+             .add_file(opt->covariates)
+             .add_file(opt->gender);
+
+      pop_manifest = std::make_shared<partition_manifest>(
+        fmt::format("{}/popstrat_uncorrected{}.manifest", output_part_dir, tag), pop_key.str(),
+        partition_paths("{}/p{}_popstrat_uncorrected", config.nb_partitions, output_part_dir));
+
+      if (!fs::exists(pcs_path))
+        pop_manifest->reset();
+    }
+
+    std::string ext = output_extension(opt->kff, opt->gzip);
+
+    stage_key agg_key("aggregation-v1");
+    agg_key.add(opt->pop_correction ? pop_key.value() : merge_key.value())
+           .add(opt->threshold / opt->cutoff)
+           .add(correction_type_str(opt->correction))
+           .add(opt->threshold)
+           .add(opt->kff)
+           .add(opt->kff_data)
+           .add(opt->gzip);
+
+    // Shards leave the outputs to diff-merge.
+    manifest_t agg_manifest {nullptr};
 
-      opt->total_kmers = do_diff<KSIZE>(opt, config, output_part_dir, accumulators, sampler);
-      redo_c = true;
+    if (!sharded)
+    {
+      agg_manifest = std::make_shared<partition_manifest>(
+        fmt::format("{}/output.manifest", opt->output_directory), agg_key.str(),
+        std::vector<std::string>{fmt::format("{}/control_kmers{}", opt->output_directory, ext),
+                                 fmt::format("{}/case_kmers{}", opt->output_directory, ext)});
+    }
+
+    bool prev_1 = merge_manifest->complete(first, last);
+    bool prev_2 = pop_manifest && pop_manifest->complete(first, last);
+    bool prev_f = agg_manifest && agg_manifest->complete();
+
+    spdlog::debug("prev1 -> {}", prev_1);
+    spdlog::debug("prev2 -> {}", prev_2);
+    spdlog::debug("prevf -> {}", prev_f);
+
+    bool redo_c = false;
+    std::vector<acc_t<KmerSign<KSIZE>>> accumulators(config.nb_partitions);
 
-      if (opt->pop_correction)
+    if (fused)
+    {
+    #ifdef WITH_POPSTRAT
+      if (!prev_2)
       {
-        geno->close();
-        snp->close();
+        opt->total_kmers = do_fused_pop<KSIZE>(
+          accumulators, pop_dir, output_part_dir, pcs_path, individuals, outside, pop_manifest,
+          opt, config);
+        redo_c = true;
       }
+    #endif
     }
     else
     {
-      opt->total_kmers = prev_opt->total_kmers;
-      for (std::size_t i = 0; i < accumulators.size(); ++i)
+      // Partitions already corrected do not need their uncorrected input.
+      std::vector<std::uint8_t> skip(config.nb_partitions, 0);
+      for (std::size_t i = 0; i < skip.size(); i++)
+        skip[i] = outside[i] || merge_manifest->done(i) || (pop_manifest && pop_manifest->done(i));
+
+      bool sample = opt->pop_correction && !fs::exists(pcs_path);
+
+      if (sample || std::count(skip.begin(), skip.end(), 0))
       {
-        accumulators[i] = std::make_shared<FileAccumulator<KmerSign<KSIZE>>>(
-          fmt::format("{}/p{}_uncorrected", output_part_dir, i), config.kmer_size, true, !opt->keep_tmp);
+        if (sample)
+        {
+          sampler = std::make_shared<Sampler<DMAX_C>>(
+            fmt::format("{}/gwas_eigenstratX.geno", pop_dir),
+            fmt::format("{}/gwas_eigenstratX.snp", pop_dir),
+            individuals, config.nb_partitions, opt->kmer_pca, opt->seed, opt->pca_text);
+        }
+
+        opt->total_kmers = do_diff<KSIZE>(
+          opt, config, output_part_dir, accumulators, sampler, merge_manifest, skip);
+        redo_c = true;
+
+        if (sampler)
+          sampler->close();
+      }
+      else if (!prev_f)
+      {
+        opt->total_kmers = merge_manifest->total();
+        for (std::size_t i = 0; i < accumulators.size(); ++i)
+        {
+          if (merge_manifest->done(i))
+            accumulators[i] = merge_accumulator<KSIZE>(
+              fmt::format("{}/p{}_uncorrected", output_part_dir, i), true, opt, config);
+        }
       }
     }
 
-    dump_opt(opt, fmt::format("{}/options.bin", opt->output_directory));
-
     #ifdef WITH_POPSTRAT
-      pop_strat_corrector::set_params(opt->max_iteration,
-                                      opt->learning_rate,
-                                      opt->epsilon,
-                                      opt->stand,
-                                      opt->irls);
-
-      if (opt->pop_correction && ((!prev_2 || (action & 0b10)) || ((action & 0b1) || !prev_1)))
+      if (!fused && opt->pop_correction && !prev_2)
       {
-        do_pop<KSIZE>(accumulators, pop_dir, output_part_dir, opt, config);
+        do_pop<KSIZE>(accumulators, pop_dir, output_part_dir, pcs_path, pop_manifest, opt, config);
         redo_c = true;
       }
     #endif
 
-    if ((!prev_f || (action > 0)) || redo_c)
+    if (prev_2 && !prev_f)
+    {
+      if (fused)
+        opt->total_kmers = pop_manifest->total();
+      for (std::size_t i = first; i < last; ++i)
+      {
+        accumulators[i] = std::make_shared<FileAccumulator<KmerSign<KSIZE>>>(
+          fmt::format("{}/p{}_popstrat_uncorrected", output_part_dir, i), config.kmer_size, true, !opt->keep_tmp);
+      }
+    }
+
+    if (sharded)
+    {
+      shard_info shard;
+      shard.first = first;
+      shard.last = last;
+      shard.nb_partitions = config.nb_partitions;
+      shard.kmer_size = config.kmer_size;
+      shard.stage = opt->pop_correction ? "popstrat_uncorrected" : "uncorrected";
+      shard.key = opt->pop_correction ? pop_key.str() : merge_key.str();
+      shard.threshold = opt->threshold;
+      shard.cutoff = opt->cutoff;
+      shard.sorted = !opt->pop_correction && opt->retain > 0;
+      shard.level = opt->threshold / opt->cutoff;
+      shard.total_kmers = opt->total_kmers;
+
+      fs::create_directories(shard_dir(opt->output_directory));
+      shard.write(fmt::format("{}/{}.shard", shard_dir(opt->output_directory), shard.name()));
+
+      spdlog::info("Shard {} written, run kmdiff diff-merge -o {} once every shard is done.",
+                   shard.name(), opt->output_directory);
+    }
+    else if (!prev_f || redo_c)
+    {
+      agg_manifest->reset();
+      do_correction<KSIZE>(accumulators, agg_manifest, opt, config, opt->total_kmers);
+    }
+    else
+    {
+      spdlog::info("Outputs are up to date.");
+    }
+
+    spdlog::info(
+      "Done in {}, Peak RSS -> {} MB.",
+      whole_time.formatted(),
+      static_cast<size_t>(get_peak_rss() * 0.0009765625)
+    );
+  }
+
+  /*
+    Aggregates the shards of an output directory. The partitions of each shard are corrected with
+    the number of k-mers tested by all of them, so that the outputs are the ones of a single run.
+  */
+  template<std::size_t KSIZE>
+  void main_diff_merge(kmdiff_options_t options)
+  {
+    diff_options_t opt = std::static_pointer_cast<struct diff_options>(options);
+
+    if (opt->kff_data && !opt->kff)
+      throw ConfigError("--kff-data requires -f/--kff-output.");
+
+    if (opt->gzip && opt->kff)
+      throw ConfigError("-z/--gzip-output cannot be used with -f/--kff-output.");
+
+    Timer whole_time;
+
+    std::vector<shard_info> shards = load_shards(opt->output_directory);
+    const shard_info& s = shards.front();
+
+    kmtricks_config_t config;
+    config.kmer_size = s.kmer_size;
+    config.nb_partitions = s.nb_partitions;
+    km::Kmer<KSIZE>::m_kmer_size = config.kmer_size;
+
+    opt->threshold = s.threshold;
+    opt->cutoff = s.cutoff;
+    opt->total_kmers = 0;
+    for (const auto& shard : shards)
+      opt->total_kmers += shard.total_kmers;
+
+    spdlog::info("Merge {} shards, {} partitions, {} k-mers tested.",
+                 shards.size(), config.nb_partitions, opt->total_kmers);
+
+    std::string output_part_dir = fmt::format("{}/partitions", opt->output_directory);
+    std::string ext = output_extension(opt->kff, opt->gzip);
+
+    stage_key agg_key("aggregation-v1");
+    for (const auto& shard : shards)
+      agg_key.add(shard.name()).add(shard.key).add(shard.level).add(shard.total_kmers);
+    agg_key.add(correction_type_str(opt->correction))
+           .add(opt->threshold)
+           .add(opt->kff)
+           .add(opt->kff_data)
+           .add(opt->gzip);
+
+    auto agg_manifest = std::make_shared<partition_manifest>(
+      fmt::format("{}/output.manifest", opt->output_directory), agg_key.str(),
+      std::vector<std::string>{fmt::format("{}/control_kmers{}", opt->output_directory, ext),
+                               fmt::format("{}/case_kmers{}", opt->output_directory, ext)});
+
+    if (agg_manifest->complete())
+    {
+      spdlog::info("Outputs are up to date.");
+      return;
+    }
+
+    // Retained partitions are sorted by p-value, and only read up to the level of the shards.
+    std::vector<acc_t<KmerSign<KSIZE>>> accumulators(config.nb_partitions);
+    for (const auto& shard : shards)
     {
-      do_correction<KSIZE>(accumulators, opt, config, opt->total_kmers);
+      for (std::size_t p = shard.first; p < shard.last; p++)
+      {
+        accumulators[p] = std::make_shared<FileAccumulator<KmerSign<KSIZE>>>(
+          fmt::format("{}/p{}_{}", output_part_dir, p, shard.stage), config.kmer_size, true,
+          !opt->keep_tmp && !shard.sorted);
+
+        if (shard.sorted)
+        {
+          double level = shard.level;
+          accumulators[p] = std::make_shared<PrefixAccumulator<KmerSign<KSIZE>>>(accumulators[p],
+            [level](const KmerSign<KSIZE>& ks) { return ks.m_pvalue <= level; });
+        }
+      }
     }
 
+    agg_manifest->reset();
+    do_correction<KSIZE>(accumulators, agg_manifest, opt, config, opt->total_kmers);
+
     spdlog::info(
       "Done in {}, Peak RSS -> {} MB.",
       whole_time.formatted(),
@@ -1,31 +1,46 @@
 #pragma once
 
+#include <vector>
+
 #include <kmdiff/cmd/cmd_common.hpp>
 
 namespace kmdiff {
   struct diff_options : kmdiff_options
   {
     std::string kmtricks_dir;
+    std::vector<std::string> kmtricks_dirs;
     std::string output_directory;
     size_t nb_controls;
     size_t nb_cases;
     double threshold;
     double cutoff;
+    double retain {0};
     CorrectionType correction;
     bool in_memory;
     bool cpr;
     bool kff;
+    bool kff_data {false};
+    bool gzip {false};
+    bool pin_threads {false};
+
+    std::string partitions;
+    std::string shard;
 
     std::string model_lib_path;
     std::string model_config;
 
     bool pop_correction;
     double kmer_pca;
+    bool pca_text {false};
+    std::string pcs;
     size_t ploidy;
     bool is_diploid;
     size_t npc;
     std::string covariates;
     std::string gender;
+    PopTest pop_test {PopTest::LRT};
+    bool pop_refit {false};
+    bool pop_fused {false};
 
     double learning_rate;
     size_t max_iteration;
@@ -52,17 +67,28 @@ namespace kmdiff {
       KRECORD(ss, nb_cases);
       KRECORD(ss, threshold);
       KRECORD(ss, cutoff);
+      KRECORD(ss, retain);
       KRECORD(ss, correction_type_str(correction));
       KRECORD(ss, in_memory);
       KRECORD(ss, kff);
+      KRECORD(ss, kff_data);
+      KRECORD(ss, gzip);
+      KRECORD(ss, pin_threads);
+      KRECORD(ss, partitions);
+      KRECORD(ss, shard);
   #ifdef WITH_POPSTRAT
       KRECORD(ss, pop_correction);
       KRECORD(ss, kmer_pca);
+      KRECORD(ss, pca_text);
+      KRECORD(ss, pcs);
       KRECORD(ss, ploidy);
       KRECORD(ss, is_diploid);
       KRECORD(ss, npc);
       KRECORD(ss, covariates);
       KRECORD(ss, gender);
+      KRECORD(ss, pop_test_str(pop_test));
+      KRECORD(ss, pop_refit);
+      KRECORD(ss, pop_fused);
   #endif
       KRECORD(ss, learning_rate);
       KRECORD(ss, max_iteration);
@@ -75,61 +101,4 @@ namespace kmdiff {
 
 using diff_options_t = std::shared_ptr<struct diff_options>;
 
-inline void dump_opt(diff_options_t opt, const std::string& path)
-{
-  std::ofstream out(path, std::ios::out | std::ios::binary);
-
-  out.write(reinterpret_cast<char*>(&opt->threshold), sizeof(opt->threshold));
-  out.write(reinterpret_cast<char*>(&opt->cutoff), sizeof(opt->cutoff));
-  out.write(reinterpret_cast<char*>(&opt->correction), sizeof(opt->correction));
-  out.write(reinterpret_cast<char*>(&opt->pop_correction), sizeof(opt->pop_correction));
-  out.write(reinterpret_cast<char*>(&opt->kmer_pca), sizeof(opt->kmer_pca));
-  out.write(reinterpret_cast<char*>(&opt->npc), sizeof(opt->npc));
-}
-
-inline diff_options_t load_opt(const std::string& path)
-{
-  std::ifstream in(path, std::ios::out | std::ios::binary);
-
-  auto opt = std::make_shared<struct diff_options>();
-
-  in.read(reinterpret_cast<char*>(&opt->threshold), sizeof(opt->threshold));
-  in.read(reinterpret_cast<char*>(&opt->cutoff), sizeof(opt->cutoff));
-  in.read(reinterpret_cast<char*>(&opt->correction), sizeof(opt->correction));
-  in.read(reinterpret_cast<char*>(&opt->pop_correction), sizeof(opt->pop_correction));
-  in.read(reinterpret_cast<char*>(&opt->kmer_pca), sizeof(opt->kmer_pca));
-  in.read(reinterpret_cast<char*>(&opt->npc), sizeof(opt->npc));
-
-  return opt;
-}
-
-inline unsigned compare_opt(diff_options_t opt, diff_options_t prev)
-{
-  unsigned r = 0;
-
-  if (opt->threshold != prev->threshold || opt->cutoff != prev->cutoff)
-    r |= 0b1;
-
-  if (prev->pop_correction && opt->pop_correction)
-  {
-    if (opt->kmer_pca != prev->kmer_pca)
-      r |= 0b11;
-    if (opt->npc != prev->npc)
-      r |= 0b10;
-  }
-
-  if (!prev->pop_correction && opt->pop_correction)
-  {
-    r |= 0b11; // 0b1 for sampling
-  }
-
-  if (opt->correction != prev->correction)
-    r |= 0b100;
-
-  if (prev->pop_correction && !opt->pop_correction)
-    r |= 0b100;
-
-  return r;
-}
-
 }
@@ -58,8 +58,6 @@ inline void main_infos()
   std::cerr << "spdlog: " << KMD_SPDLOG_SHA1 << "\n";
   std::cerr << "xxHash: " << KMD_XXHASH_SHA1 << "\n";
   std::cerr << "indicators: " << KMD_INDICATORS_SHA1 << "\n";
-  std::cerr << "gsl: " << KMD_GSL_VERSION << "\n";
-  std::cerr << "openblas: " << KMD_OPENBLAS_VERSION << "\n";
   std::cerr << std::flush;
 }
 
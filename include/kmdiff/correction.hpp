@@ -14,5 +14,14 @@ namespace kmdiff {
   };
 
   std::string correction_type_str(const CorrectionType type);
+
+  // Test used for the population stratification correction.
+  enum class PopTest
+  {
+    LRT,
+    SCORE
+  };
+
+  std::string pop_test_str(const PopTest test);
 }
 
@@ -71,5 +71,21 @@ namespace kmdiff {
       }
   };
 
+  /*
+    Implemented by the models which only need the nonzero counts of a k-mer, e.g. their sums, so
+    that the merge does not scan the dense vector for them. Kept apart from IModel so that the
+    layout of IModel, which plugins implement, does not change.
+  */
+  template<std::size_t MAX_C>
+  class ISparseModel
+  {
+    public:
+      using count_type = typename km::selectC<MAX_C>::type;
+
+      virtual ~ISparseModel() {}
+
+      virtual model_ret_t process_sparse(const SparseCounts<count_type>& counts) = 0;
+  };
+
 } // end of namespace kmdiff
 
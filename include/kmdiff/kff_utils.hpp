@@ -16,24 +16,205 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  *****************************************************************************/
 
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <memory>
+#include <optional>
+#include <vector>
 
+#include <fmt/format.h>
 #include <kff_io.hpp>
 
 #include <kmdiff/kmer.hpp>
+#include <kmdiff/exceptions.hpp>
 
 namespace kmdiff {
 
   using kff_t = std::unique_ptr<Kff_file>;
   using kff_raw_t = std::unique_ptr<Section_Raw>;
 
+  /*
+    km::Kmer stores a k-mer as a 2k-bit integer (first nucleotide in the most significant bits,
+    word 0 is the least significant one) with the same 2-bit encoding as the one written in the
+    kff header, i.e. A=0, C=1, T=2, G=3. Conversions between k-mers and kff sequences are
+    therefore only shifts and masks.
+  */
+  namespace kff_detail {
+
+    template<std::size_t MAX_K>
+    constexpr std::size_t nb_words = (MAX_K + 31) / 32;
+
+    template<std::size_t MAX_K>
+    inline const uint64_t* words(const km::Kmer<MAX_K>& kmer)
+    {
+      return kmer.get_data64();
+    }
+
+    template<std::size_t MAX_K>
+    inline uint64_t* words(km::Kmer<MAX_K>& kmer)
+    {
+      return kmer.get_data64_unsafe();
+    }
+
+    inline uint64_t word_mask(std::size_t i, std::size_t kmer_size)
+    {
+      const std::size_t lo = i * 64;
+      const std::size_t bits = 2 * kmer_size;
+
+      if (bits <= lo)
+        return 0;
+      else if (bits - lo >= 64)
+        return ~0ULL;
+      return (1ULL << (bits - lo)) - 1;
+    }
+
+    inline uint8_t nt_at(const uint64_t* data, std::size_t i, std::size_t kmer_size)
+    {
+      const std::size_t shift = 2 * (kmer_size - 1 - i);
+      return (data[shift / 64] >> (shift % 64)) & 0b11;
+    }
+
+    using words_t = std::array<uint64_t, 8>;
+
+    inline bool less(const words_t& a, const words_t& b, std::size_t w)
+    {
+      for (std::size_t i = w; i-- > 0;)
+      {
+        if (a[i] != b[i])
+          return a[i] < b[i];
+      }
+      return false;
+    }
+
+    // the k-mer that follows x in a sequence if the next nucleotide is nt
+    inline words_t successor(const words_t& x, uint8_t nt, std::size_t w, std::size_t kmer_size)
+    {
+      words_t out {};
+      for (std::size_t i = 0; i < w; i++)
+        out[i] = ((x[i] << 2) | (i > 0 ? x[i - 1] >> 62 : 0)) & word_mask(i, kmer_size);
+      out[0] |= nt;
+      return out;
+    }
+
+    // the k-mer that precedes x in a sequence if the previous nucleotide is nt
+    inline words_t predecessor(const words_t& x, uint8_t nt, std::size_t w, std::size_t kmer_size)
+    {
+      words_t out {};
+      for (std::size_t i = 0; i < w; i++)
+        out[i] = (x[i] >> 2) | (i + 1 < w ? x[i + 1] << 62 : 0);
+      const std::size_t shift = 2 * (kmer_size - 1);
+      out[shift / 64] |= static_cast<uint64_t>(nt) << (shift % 64);
+      return out;
+    }
+
+    inline uint64_t mix(uint64_t x)
+    {
+      x ^= x >> 33;
+      x *= 0xff51afd7ed558ccdULL;
+      x ^= x >> 33;
+      x *= 0xc4ceb9fe1a85ec53ULL;
+      x ^= x >> 33;
+      return x;
+    }
+
+    // smallest hashed m-mer of a k-mer, hashed so that poly-A runs do not gather everything
+    inline uint64_t minimizer(const uint64_t* data, std::size_t kmer_size, std::size_t m)
+    {
+      const uint64_t mask = m >= 32 ? ~0ULL : (1ULL << (2 * m)) - 1;
+      uint64_t mmer = 0;
+      uint64_t best = ~0ULL;
+      for (std::size_t i = 0; i < kmer_size; i++)
+      {
+        mmer = ((mmer << 2) | nt_at(data, i, kmer_size)) & mask;
+        if (i + 1 >= m)
+          best = std::min(best, mix(mmer));
+      }
+      return best;
+    }
+
+  } // end of namespace kff_detail
+
+  /*
+    Per k-mer kff data payload (data_size = kff_payload::size), little-endian:
+      [0, 4)   float  log10(p-value)
+      [4, 8)   float  mean control (normalized)
+      [8, 12)  float  mean case
+      [12, 13) uint8  significance, see Significance
+    The p-value is stored in log10 space because corrected p-values are far below FLT_MIN.
+  */
+  struct kff_payload
+  {
+    static constexpr std::size_t size = 13;
+
+    template<size_t MAX_K>
+    static void encode(const KmerSign<MAX_K>& ks, uint8_t* out)
+    {
+      put_float(out, static_cast<float>(std::log10(ks.m_pvalue)));
+      put_float(out + 4, static_cast<float>(ks.m_mean_control));
+      put_float(out + 8, static_cast<float>(ks.m_mean_case));
+      out[12] = static_cast<uint8_t>(ks.m_sign);
+    }
+
+    template<size_t MAX_K>
+    static void decode(const uint8_t* in, KmerSign<MAX_K>& ks)
+    {
+      ks.m_pvalue = std::pow(10.0, static_cast<double>(get_float(in)));
+      ks.m_mean_control = get_float(in + 4);
+      ks.m_mean_case = get_float(in + 8);
+      ks.m_sign = static_cast<Significance>(in[12]);
+    }
+
+  private:
+    static void put_float(uint8_t* out, float value)
+    {
+      static_assert(sizeof(float) == sizeof(uint32_t));
+      uint32_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      for (std::size_t i = 0; i < 4; i++)
+        out[i] = static_cast<uint8_t>(bits >> (8 * i));
+    }
+
+    static float get_float(const uint8_t* in)
+    {
+      uint32_t bits = 0;
+      for (std::size_t i = 0; i < 4; i++)
+        bits |= static_cast<uint32_t>(in[i]) << (8 * i);
+      float value;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+  };
+
+  /*
+    K-mers are buffered by batches of s_batch_size. A batch is grouped by minimizer, and the
+    k-mers of a group are chained into super-k-mers, i.e. runs of k-mers overlapping by k-1,
+    each one written as a block of at most max k-mers. The k-mers are therefore not written
+    in input order. Only forward overlaps are chained: two canonical k-mers that are adjacent
+    on opposite strands of a sequence end up in different blocks.
+  */
   class KffWriter
   {
+    struct pending_kmer
+    {
+      uint64_t minimizer;
+      kff_detail::words_t words;
+      uint32_t index;
+    };
+
   public:
-    KffWriter(const std::string& path, size_t kmer_size)
-      : m_kmer_size(kmer_size)
+    static constexpr std::size_t s_batch_size = 1 << 16;
+    static constexpr std::size_t s_minim_size = 10;
+
+    KffWriter(const std::string& path, size_t kmer_size, size_t max_per_block = 255, bool with_data = false)
+      : m_kmer_size(kmer_size), m_max(max_per_block),
+        m_data_size(with_data ? kff_payload::size : 0),
+        m_nb_words((2 * kmer_size + 63) / 64)
     {
       m_kff_file = std::make_unique<Kff_file>(path, "w");
       uint8_t encoding[] = {0, 1, 3, 2};
@@ -41,69 +222,189 @@ namespace kmdiff {
 
       Section_GV sgv(m_kff_file.get());
       sgv.write_var("k", m_kmer_size);
-      sgv.write_var("max", 1);
-      sgv.write_var("data_size", 0);
+      sgv.write_var("max", m_max);
+      sgv.write_var("data_size", m_data_size);
       sgv.close();
       m_kff_sec = std::make_unique<Section_Raw>(m_kff_file.get());
+
+      m_seq.resize(m_kmer_size + m_max - 1);
+      m_encoded.resize((m_seq.size() + 3) / 4);
+      m_data.resize(m_max * m_data_size, 0);
     }
 
     template<size_t MAX_K>
-    void write(KmerSign<MAX_K>& kmer)
+    void write(const KmerSign<MAX_K>& kmer)
     {
-      uint8_t encoded[1024];
-      m_kmer = kmer.m_kmer.to_string();
-      encode_sequence(encoded);
-      m_kff_sec->write_compacted_sequence(encoded, m_kmer_size, nullptr);
+      write(kmer.m_kmer);
+      if (m_data_size)
+        kff_payload::encode(kmer, &m_pending_data[(m_pending.size() - 1) * m_data_size]);
     }
 
     template<size_t MAX_K>
-    void write(km::Kmer<MAX_K>& kmer)
+    void write(const km::Kmer<MAX_K>& kmer)
     {
-      uint8_t encoded[1024];
-      m_kmer = kmer.to_string();
-      encode_sequence(encoded);
-      m_kff_sec->write_compacted_sequence(encoded, m_kmer_size, nullptr);
+      constexpr std::size_t W = kff_detail::nb_words<MAX_K>;
+      static_assert(W <= std::tuple_size_v<kff_detail::words_t>, "MAX_K too large for KffWriter.");
+      const uint64_t* data = kff_detail::words(kmer);
+
+      if (m_pending.size() == s_batch_size)
+        pack();
+
+      pending_kmer& p = m_pending.emplace_back();
+      p.minimizer = kff_detail::minimizer(data, m_kmer_size, std::min(m_kmer_size, s_minim_size));
+      p.words = {};
+      std::copy(data, data + W, p.words.begin());
+      p.index = static_cast<uint32_t>(m_pending.size() - 1);
+
+      m_pending_data.resize(m_pending.size() * m_data_size, 0);
     }
 
     void close()
     {
+      pack();
       m_kff_sec->close();
       m_kff_file->close();
     }
 
-    uint8_t uint8_packing(std::string sequence)
+  private:
+    void pack()
+    {
+      const std::size_t w = m_nb_words;
+      std::sort(m_pending.begin(), m_pending.end(), [w](const auto& a, const auto& b) {
+        if (a.minimizer != b.minimizer)
+          return a.minimizer < b.minimizer;
+        return kff_detail::less(a.words, b.words, w);
+      });
+
+      m_used.assign(m_pending.size(), 0);
+      for (std::size_t first = 0; first < m_pending.size();)
+      {
+        std::size_t last = first + 1;
+        while (last < m_pending.size() && m_pending[last].minimizer == m_pending[first].minimizer)
+          last++;
+        chain(first, last);
+        first = last;
+      }
+
+      m_pending.clear();
+      m_pending_data.clear();
+    }
+
+    // Chains start at the k-mers without an unused predecessor, then at the ones left (cycles).
+    void chain(std::size_t first, std::size_t last)
+    {
+      for (int pass = 0; pass < 2; pass++)
+      {
+        for (std::size_t i = first; i < last; i++)
+        {
+          if (m_used[i] || (pass == 0 && has_predecessor(i, first, last)))
+            continue;
+
+          for (std::size_t j = i; j != last; j = next(j, first, last))
+            append(j);
+          flush();
+        }
+      }
+    }
+
+    std::size_t find(const kff_detail::words_t& words, std::size_t first, std::size_t last) const
+    {
+      const std::size_t w = m_nb_words;
+      auto it = std::lower_bound(m_pending.begin() + first, m_pending.begin() + last, words,
+        [w](const auto& p, const auto& x) { return kff_detail::less(p.words, x, w); });
+
+      std::size_t i = it - m_pending.begin();
+      if (i < last && !m_used[i] && !kff_detail::less(words, it->words, w))
+        return i;
+      return last;
+    }
+
+    bool has_predecessor(std::size_t i, std::size_t first, std::size_t last) const
     {
-      size_t size = sequence.size();
-      uint8_t val = 0;
-      for (size_t i = 0; i < size; i++)
+      for (uint8_t nt = 0; nt < 4; nt++)
       {
-        val <<= 2;
-        val += (sequence[i] >> 1) & 0b11;
+        auto pred = kff_detail::predecessor(m_pending[i].words, nt, m_nb_words, m_kmer_size);
+        std::size_t j = find(pred, first, last);
+        if (j != last && j != i)
+          return true;
       }
-      return val;
+      return false;
     }
 
-    void encode_sequence(uint8_t* encoded)
+    std::size_t next(std::size_t i, std::size_t first, std::size_t last) const
     {
-      size_t size = m_kmer.length();
-      size_t remnant = size % 4;
-      if (remnant > 0)
+      for (uint8_t nt = 0; nt < 4; nt++)
       {
-        encoded[0] = uint8_packing(m_kmer.substr(0, remnant));
-        encoded += 1;
+        auto succ = kff_detail::successor(m_pending[i].words, nt, m_nb_words, m_kmer_size);
+        std::size_t j = find(succ, first, last);
+        if (j != last)
+          return j;
       }
+      return last;
+    }
+
+    void append(std::size_t i)
+    {
+      if (m_nb_kmers == m_max)
+        flush();
+
+      const uint64_t* data = m_pending[i].words.data();
+      if (!m_nb_kmers)
+      {
+        for (std::size_t j = 0; j < m_kmer_size; j++)
+          m_seq[j] = kff_detail::nt_at(data, j, m_kmer_size);
+      }
+      else
+      {
+        m_seq[m_kmer_size + m_nb_kmers - 1] = data[0] & 0b11;
+      }
+
+      if (m_data_size)
+        std::copy_n(&m_pending_data[m_pending[i].index * m_data_size], m_data_size,
+                    &m_data[m_nb_kmers * m_data_size]);
 
-      size_t nb_uint_needed = size / 4;
-      for (size_t i = 0; i < nb_uint_needed; i++)
+      m_used[i] = 1;
+      m_nb_kmers++;
+    }
+
+    void flush()
+    {
+      if (!m_nb_kmers)
+        return;
+
+      const std::size_t size = m_kmer_size + m_nb_kmers - 1;
+      const std::size_t nb_bytes = (size + 3) / 4;
+      const std::size_t pad = nb_bytes * 4 - size;
+
+      std::fill(m_encoded.begin(), m_encoded.begin() + nb_bytes, 0);
+
+      for (std::size_t i = 0; i < size; i++)
       {
-        encoded[i] = uint8_packing(m_kmer.substr(remnant + 4 * i, 4));
+        const std::size_t pos = i + pad;
+        m_encoded[pos / 4] |= m_seq[i] << (2 * (3 - (pos % 4)));
       }
+
+      m_kff_sec->write_compacted_sequence(
+        m_encoded.data(), size, m_data_size ? m_data.data() : nullptr);
+      m_nb_kmers = 0;
     }
+
   private:
     kff_t m_kff_file {nullptr};
     kff_raw_t m_kff_sec {nullptr};
     size_t m_kmer_size;
-    std::string m_kmer;
+    size_t m_max {255};
+    size_t m_data_size {0};
+    size_t m_nb_words {1};
+
+    std::vector<pending_kmer> m_pending;
+    std::vector<uint8_t> m_pending_data;
+    std::vector<uint8_t> m_used;
+
+    size_t m_nb_kmers {0};
+    std::vector<uint8_t> m_seq;
+    std::vector<uint8_t> m_encoded;
+    std::vector<uint8_t> m_data;
   };
 
   using kff_w_t = std::unique_ptr<KffWriter>;
@@ -112,52 +413,67 @@ namespace kmdiff {
 
   class KffReader
   {
-    std::string nt[4] = {"A", "C", "T", "G"};
   public:
     KffReader(const std::string& path, size_t kmer_size)
     {
       m_kff_reader = std::make_unique<Kff_reader>(path);
       m_kmer_size = kmer_size;
       m_data_size = 0;
-      for (int i=0; i<256; i++)
-      {
-        for (int j=0; j<4; j++)
-        {
-          uint8_t n = (i>>(2*j)) & 0b11;
-          m_lookup[i] = nt[n] + m_lookup[i];
-        }
-      }
     }
 
     template<size_t MAX_K>
     std::optional<km::Kmer<MAX_K>> read()
     {
-      static km::Kmer<MAX_K> kmer;
-      kmer.set_k(m_kmer_size);
       if (m_kff_reader->has_next())
       {
+        km::Kmer<MAX_K> kmer;
+        kmer.set_k(m_kmer_size);
         m_kff_reader->next_kmer(m_buffer, m_data);
-        return km::Kmer<MAX_K>(to_string());
+        decode<MAX_K>(kmer);
+        return kmer;
       }
       return std::nullopt;
     }
 
-  private:
-    std::string to_string()
+    // Requires a file written with a data payload (see kff_payload).
+    template<size_t MAX_K>
+    std::optional<KmerSign<MAX_K>> read_sign()
     {
-      size_t size = m_kmer_size % 4 == 0 ? m_kmer_size / 4 : m_kmer_size / 4 + 1;
-      std::string str_kmer = m_lookup[m_buffer[0]];
-      if (m_kmer_size % 4 != 0)
+      if (m_kff_reader->has_next())
       {
-        int trunc = 4 - (m_kmer_size % 4);
-        str_kmer = str_kmer.substr(trunc);
+        KmerSign<MAX_K> ks;
+        ks.set_k(m_kmer_size);
+        m_kff_reader->next_kmer(m_buffer, m_data);
+
+        if (!m_data_size)
+        {
+          m_data_size = m_kff_reader->get_var("data_size");
+          if (m_data_size != kff_payload::size)
+            throw IOError(fmt::format("kff: unexpected data size {} (expected {}).",
+                                      m_data_size, kff_payload::size));
+        }
+
+        decode<MAX_K>(ks.m_kmer);
+        kff_payload::decode(m_data, ks);
+        return ks;
       }
-      for (size_t i=1; i<size; i++)
+      return std::nullopt;
+    }
+
+  private:
+    template<size_t MAX_K>
+    void decode(km::Kmer<MAX_K>& kmer)
+    {
+      constexpr std::size_t W = kff_detail::nb_words<MAX_K>;
+      uint64_t* data = kff_detail::words(kmer);
+      std::fill(data, data + W, 0);
+
+      const std::size_t nb_bytes = (m_kmer_size + 3) / 4;
+      for (std::size_t j = 0; j < nb_bytes; j++)
       {
-        uint8_t v = m_buffer[i];
-        str_kmer += m_lookup[v];
+        const std::size_t shift = 8 * j;
+        data[shift / 64] |= static_cast<uint64_t>(m_buffer[nb_bytes - 1 - j]) << (shift % 64);
       }
-      return str_kmer;
     }
 
     kff_reader_t m_kff_reader {nullptr};
@@ -165,10 +481,8 @@ namespace kmdiff {
     size_t m_data_size{0};
     uint8_t* m_buffer {nullptr};
     uint8_t* m_data {nullptr};
-    std::string m_lookup[256];
   };
 
   using kff_r_t = std::unique_ptr<KffReader>;
 
 } // end of namespace kmdiff
-
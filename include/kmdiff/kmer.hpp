@@ -28,6 +28,8 @@
 
 #include <kmtricks/kmer.hpp>
 
+#include <kmdiff/range.hpp>
+
 namespace kmdiff {
 
   enum class Significance
@@ -37,6 +39,9 @@ namespace kmdiff {
     NO
   };
 
+  // Counts as merged from kmtricks, on the smallest type which holds DMAX_C.
+  using kmer_count_t = km::selectC<DMAX_C>::type;
+
   inline char significance_to_char(Significance sign)
   {
     switch (sign)
@@ -59,8 +64,8 @@ namespace kmdiff {
    public:
   #ifdef WITH_POPSTRAT
     KmerSign(km::Kmer<MAX_K>&& kmer, double pvalue, Significance sign,
-             std::vector<double>& counts_ratio, double mean_control = 0, double mean_case = 0)
-        : m_kmer(std::move(kmer)), m_pvalue(pvalue), m_sign(sign), m_counts_ratio(counts_ratio),
+             const SparseCounts<kmer_count_t>& counts = {}, double mean_control = 0, double mean_case = 0)
+        : m_kmer(std::move(kmer)), m_pvalue(pvalue), m_sign(sign), m_counts(counts),
           m_mean_control(mean_control), m_mean_case(mean_case)
     {
     }
@@ -100,11 +105,7 @@ namespace kmdiff {
       stream->read(reinterpret_cast<char*>(&m_mean_case), sizeof(m_mean_case));
 
       #ifdef WITH_POPSTRAT
-        std::uint16_t size_ = 0;
-        stream->read(reinterpret_cast<char*>(&size_), sizeof(size_));
-        m_counts_ratio.resize(size_, 0);
-        stream->read(reinterpret_cast<char*>(m_counts_ratio.data()),
-                     size_*sizeof(double));
+        m_counts.load(*stream);
       #endif
 
       return true;
@@ -119,10 +120,7 @@ namespace kmdiff {
       stream->write(reinterpret_cast<char*>(&m_mean_case), sizeof(m_mean_case));
 
       #ifdef WITH_POPSTRAT
-        std::uint16_t size = m_counts_ratio.size();
-        stream->write(reinterpret_cast<char*>(&size), sizeof(size));
-        stream->write(reinterpret_cast<char*>(m_counts_ratio.data()),
-                      size*sizeof(double));
+        m_counts.dump(*stream);
       #endif
     }
 
@@ -139,7 +137,7 @@ namespace kmdiff {
     Significance m_sign{Significance::NO};
 
     #ifdef WITH_POPSTRAT
-      std::vector<double> m_counts_ratio;
+      SparseCounts<kmer_count_t> m_counts;
     #endif
 
     double m_mean_control;
@@ -21,6 +21,7 @@
 // std
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -54,11 +55,106 @@ namespace kmdiff
 
   kmtricks_config_t get_kmtricks_config(const std::string& run_dir);
 
+  /*
+    Several runs can be analysed as one, with their samples in the order of the runs, e.g. a
+    reference set of controls and a batch of cases counted separately. They must share k and the
+    minimizer repartition, so that a k-mer falls in the same partition in each of them.
+  */
+  kmtricks_config_t get_kmtricks_config(const std::vector<std::string>& run_dirs);
+
+  // KmDir is bound to one run at a time.
+  void bind_run(const std::string& run_dir);
+
   km::Fof get_fofs(const std::string& run_dir);
 
   std::tuple<std::vector<size_t>, std::vector<size_t>> get_total_kmer(
       const std::string& run_dir, size_t nb_controls, size_t nb_cases, size_t ab_min);
 
+  // Each run with its own abundance min, from the run manifests.
+  std::tuple<std::vector<size_t>, std::vector<size_t>> get_total_kmer(
+      const std::vector<std::string>& run_dirs, size_t nb_controls, size_t nb_cases);
+
   part_paths_t get_partition_paths(const std::string& kmdir, std::size_t nb_parts);
 
+  // Count files of all the runs, merged per partition, from the run manifests.
+  part_paths_t get_partition_paths(const std::vector<std::string>& run_dirs, std::size_t nb_parts);
+
+  // Size in bytes of the count files of each partition, over all the runs.
+  std::vector<std::uintmax_t> get_partition_sizes(const std::vector<std::string>& run_dirs);
+
+  // The fof of the run, or the fofs of several runs concatenated in dir. A sample id can only
+  // be in one run.
+  std::string fof_path(const std::vector<std::string>& run_dirs, const std::string& dir);
+
+  // The options of the run, or the options of several runs in dir, one line per run.
+  std::string options_path(const std::vector<std::string>& run_dirs, const std::string& dir);
+
+  // Fingerprint of a run: its fof and options, the size and time of its matrix and histogram
+  // files, and the time of its count directories. It changes whenever the run is redone.
+  std::uint64_t run_key(const std::string& run_dir);
+
+  // Key of several runs, from the run manifests, which compute it once per process.
+  std::uint64_t run_key(const std::vector<std::string>& run_dirs);
+
+  // Throws if a count file of partition p changed since its run was indexed, see
+  // run_manifest::check.
+  void check_partition(const std::vector<std::string>& run_dirs, std::size_t p);
+
+  /*
+    What a diff reads from a run before the first k-mer: its config, the number of k-mers of each
+    sample above each abundance, and the count files of each partition with their size and time.
+    It is built with s_nb_threads threads, cached in the run directory under the run key, and
+    loaded once per process. KmDir is bound to the run when it is built.
+  */
+  class run_manifest
+  {
+    public:
+      inline static std::size_t s_nb_threads = 1;
+
+      static std::shared_ptr<const run_manifest> get(const std::string& run_dir);
+
+      const kmtricks_config_t& config() const { return m_config; }
+      std::size_t nb_samples() const { return m_ids.size(); }
+      const std::string& id(std::size_t i) const { return m_ids[i]; }
+
+      // K-mers of a sample with an abundance >= ab_min, by default the one of the sample.
+      std::size_t total(std::size_t i) const { return total(i, m_ab_mins[i]); }
+      std::size_t total(std::size_t i, std::size_t ab_min) const;
+
+      const part_paths_t& partitions() const { return m_partitions; }
+      const std::vector<std::uintmax_t>& sizes() const { return m_sizes; }
+
+      // Run key under which the manifest is cached.
+      std::uint64_t key() const { return m_key; }
+
+      // The run key does not state every count file. A file rewritten in place is found here,
+      // when its partition is merged: its partition directory is touched so that the key
+      // changes, and an IOError is thrown.
+      void check(std::size_t p) const;
+
+    private:
+      void build(const std::string& run_dir);
+      bool load(const std::string& path, std::uint64_t key);
+      void save(const std::string& path, std::uint64_t key) const;
+
+    private:
+      static constexpr int s_version = 2;
+
+      struct file_stat
+      {
+        std::uint64_t size {0};
+        std::int64_t mtime {0};
+      };
+
+    private:
+      kmtricks_config_t m_config;
+      std::vector<std::string> m_ids;
+      std::vector<std::uint32_t> m_ab_mins;
+      std::vector<std::vector<std::uint64_t>> m_totals;
+      part_paths_t m_partitions;
+      std::vector<std::uintmax_t> m_sizes;
+      std::vector<std::vector<file_stat>> m_stats;
+      std::uint64_t m_key {0};
+  };
+
 } // end of namespace kmdiff
@@ -17,10 +17,68 @@ namespace kmdiff {
 
   using vector_ull_t = std::vector<std::size_t>;
 
+  // Row-major matrix stored in one contiguous buffer.
+  class dense_matrix
+  {
+    public:
+      dense_matrix() = default;
+
+      dense_matrix(size_t rows, size_t cols, double value = 0.0)
+        : m_rows(rows), m_cols(cols), m_data(rows * cols, value)
+      {}
+
+      explicit dense_matrix(const matrix_t& m);
+
+      double* operator[](size_t i) { return m_data.data() + i * m_cols; }
+      const double* operator[](size_t i) const { return m_data.data() + i * m_cols; }
+
+      double* data() { return m_data.data(); }
+      const double* data() const { return m_data.data(); }
+
+      size_t rows() const { return m_rows; }
+      size_t cols() const { return m_cols; }
+
+      // Reshapes the matrix and sets all its values, reuses the buffer when possible.
+      void assign(size_t rows, size_t cols, double value = 0.0)
+      {
+        m_rows = rows;
+        m_cols = cols;
+        m_data.assign(rows * cols, value);
+      }
+
+      matrix_t to_matrix() const;
+
+    private:
+      size_t m_rows {0};
+      size_t m_cols {0};
+      vector_t m_data;
+  };
+
+  // (model, singular, nan, error, iterations)
+  using glm_fit_t = std::tuple<vector_t, bool, bool, double, int>;
+
+  // Preallocated buffers of the glm solvers, reused from one fit to the next.
+  struct glm_workspace
+  {
+    glm_fit_t fit;
+    vector_t eta;
+    vector_t mu;
+    vector_t s;
+    vector_t z;
+    vector_t v;
+    vector_t w;
+    dense_matrix hessian;
+
+    void init(size_t n, size_t p);
+  };
+
   size_t nrows(const matrix_t& m);
   size_t ncols(const matrix_t& m);
+  size_t nrows(const dense_matrix& m);
+  size_t ncols(const dense_matrix& m);
   void print_matrix(const matrix_t& m);
   std::string str_matrix(const matrix_t& m);
+  std::string str_matrix(const dense_matrix& m);
 
   template<typename T>
   std::string str_vector(const T& v)
@@ -43,9 +101,29 @@ namespace kmdiff {
   std::tuple<matrix_t, matrix_t> lu_decomposition(const matrix_t& orig, size_t n);
   std::tuple<matrix_t, bool, bool> inverse(const matrix_t& m, size_t n);
 
+  // res = m1 * m2
+  void multiply(const dense_matrix& m1, const dense_matrix& m2, dense_matrix& res);
+  // res = Xt * diag(w) * X, without building Xt. w == nullptr stands for the identity.
+  void xtwx(const dense_matrix& x, const double* w, dense_matrix& res);
+  // res = Xt * v
+  void xtv(const dense_matrix& x, const double* v, double* res);
+  // res = X * v
+  void xv(const dense_matrix& x, const double* v, double* res);
+  // Cholesky factorization m = L.Lt of a symmetric positive definite m, L is stored in the lower
+  // triangle of m. Returns (singular, nan).
+  std::tuple<bool, bool> cholesky_factor(dense_matrix& m);
+  // Solves L.Lt.x = b in place of b, l from cholesky_factor.
+  void cholesky_substitute(const dense_matrix& l, double* b);
+  // Solves m.x = b in place of b for a symmetric positive definite m, m is overwritten by its
+  // Cholesky factor. Returns (singular, nan).
+  std::tuple<bool, bool> cholesky_solve(dense_matrix& m, double* b);
+
   double sigmoid(double x);
   double linear_predictor(const vector_t& model, const vector_t& data);
   double predict(const vector_t& model, const vector_t& data);
+  double log_sigmoid(double x);
+  double log_likelihood(const vector_t& model, const matrix_t& x, const vector_t& y);
+  double log_likelihood(const vector_t& model, const dense_matrix& x, const vector_t& y);
   std::tuple<vector_t, bool, bool, double, int> glm_newton_raphson(const matrix_t& x,
                                                                    const vector_t& y,
                                                                    double gamma,
@@ -53,5 +131,95 @@ namespace kmdiff {
   std::tuple<vector_t, bool, bool, double, int> glm_irls(const matrix_t& x,
                                                          const vector_t& y,
                                                          int max_iters);
+
+  // The dense versions return ws.fit, they do not allocate once ws is sized.
+  const glm_fit_t& glm_newton_raphson(const dense_matrix& x,
+                                      const vector_t& y,
+                                      double gamma,
+                                      int max_iters,
+                                      glm_workspace& ws);
+  const glm_fit_t& glm_irls(const dense_matrix& x,
+                            const vector_t& y,
+                            int max_iters,
+                            glm_workspace& ws,
+                            const vector_t& start = {});
+
+  /*
+    Rao score test of an additional column against a fitted logistic null model. Only the null
+    model is needed: for a column c, U = ct.(y - mu) and V = ct.W.c - ct.W.X.(Xt.W.X)^-1.Xt.W.c,
+    with W = diag(mu.(1 - mu)), and U^2 / V is chi-squared with one degree of freedom.
+  */
+  class score_test
+  {
+    public:
+      score_test() = default;
+      score_test(const dense_matrix& x, const vector_t& y, const vector_t& model);
+
+      // Statistic of the column c (size n), v is a buffer of size p. Returns 0 when c is
+      // (numerically) a combination of the null columns or when the null information is singular.
+      double statistic(const double* c, vector_t& v) const;
+
+    private:
+      dense_matrix m_x;
+      vector_t m_w;
+      vector_t m_r;
+      dense_matrix m_info;
+      bool m_valid {false};
+  };
+
+  /*
+    IRLS on a batch of designs that share all their columns but the last one, e.g. the alt
+    models of several k-mers. Buffers are laid out as [row][lane], with one lane per design, so
+    that inner loops run across the lanes and vectorize. The products of the shared columns are
+    computed once. Each lane follows glm_irls (same updates and stopping rules) and gives the
+    same result.
+  */
+  class batch_irls
+  {
+    public:
+      // x: n x (p - 1) shared columns, y: responses
+      batch_irls(const dense_matrix& x, const vector_t& y);
+
+      // cols: one row of size n per design, holding its last column.
+      void fit(const dense_matrix& cols,
+               int max_iters,
+               std::vector<glm_fit_t>& res,
+               const vector_t& start = {});
+
+      // Log-likelihood of the designs from the last fit, with their fitted models.
+      void log_likelihoods(const std::vector<glm_fit_t>& res, vector_t& ll);
+
+    private:
+      size_t idx(size_t j, size_t k) const { return j * m_p + k; }
+
+      // Moves the active lanes to the front of the buffers.
+      void compact(size_t nb_lanes);
+
+    private:
+      const dense_matrix& m_x;
+      const vector_t& m_y;
+      size_t m_n {0};
+      size_t m_p {0};
+      size_t m_lanes {0};
+
+      dense_matrix m_xx;   // n x p*p, products of the shared columns
+      dense_matrix m_c;    // n x lanes
+      dense_matrix m_cw;   // n x lanes, active lanes only
+      dense_matrix m_eta;  // n x lanes
+      dense_matrix m_mu;   // n x lanes
+      dense_matrix m_s;    // n x lanes
+      dense_matrix m_z;    // n x lanes
+      dense_matrix m_h;    // p*p x lanes
+      dense_matrix m_b;    // p x lanes
+      dense_matrix m_w;    // p x lanes
+      vector_t m_eta_l;    // lanes
+
+      vector_t m_error;
+      vector_t m_prev_error;
+      vector_t m_good;
+      std::vector<char> m_active;
+      std::vector<char> m_failed;
+      std::vector<size_t> m_map;
+  };
 } // end of namespace kmdiff
 
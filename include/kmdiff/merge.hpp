@@ -19,6 +19,9 @@
 #pragma once
 
 // std
+#include <algorithm>
+#include <filesystem>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -59,18 +62,60 @@ namespace kmdiff {
           m_nb_controls(controls),
           m_nb_cases(cases),
           m_part(partition),
-          m_smat(smat)
+          m_smat(smat),
+          m_sparse_model(dynamic_cast<ISparseModel<CMAX>*>(model.get())),
+          m_significance(threshold)
       {
-        m_counts.resize(m_nb_controls + m_nb_cases, 0);
       }
 
+      // With --retain, the k-mers are kept up to the retention level, but only the ones up to the
+      // significance level are counted and written to the sign matrix.
+      void set_significance(double level) { m_significance = level; }
+
     public:
       void process(km::Kmer<KSIZE>& kmer, std::vector<count_type>& counts) override
       {
-        Range<count_type> range_controls(counts, 0, m_nb_controls);
-        Range<count_type> range_cases(counts, m_nb_controls, m_nb_cases);
+        m_has_sparse = false;
+        this->test(kmer, counts);
+      }
+
+      // Called once the partition is merged, before its accumulator is finished.
+      virtual void flush() {}
+
+      std::size_t total() const { return m_total; }
+      std::size_t nb_sign() const { return m_sign_kmer_per_part; }
+
+      std::tuple<std::size_t, std::size_t> nb_signs() const
+      {
+        return std::make_tuple(m_sign_controls, m_sign_cases);
+      }
+
+    protected:
+      virtual void push(KmerSign<KSIZE>&& ks)
+      {
+        m_acc->push(std::move(ks));
+      }
+
+      // Nonzero counts of the current k-mer, built once and only when needed: by a sparse model,
+      // a sampler, or a k-mer kept with its counts. process() resets it for each k-mer.
+      const SparseCounts<count_type>& sparse(const std::vector<count_type>& counts)
+      {
+        if (!m_has_sparse)
+        {
+          m_sparse.assign(counts, m_nb_controls);
+          m_has_sparse = true;
+        }
+        return m_sparse;
+      }
 
-        auto [p_value, sign, mean_ctr, mean_case] = m_model->process(range_controls, range_cases);
+      // Models which only need the nonzero counts do not scan the dense vector again, and the
+      // significant k-mers keep their sparse counts.
+      void test(km::Kmer<KSIZE>& kmer, std::vector<count_type>& counts)
+      {
+        auto [p_value, sign, mean_ctr, mean_case] = m_sparse_model
+          ? m_sparse_model->process_sparse(sparse(counts))
+          : m_model->process(Range<count_type>(counts, 0, m_nb_controls),
+                             Range<count_type>(counts, m_nb_controls, m_nb_cases));
 
         //spdlog::debug("P{}: {} {} {} {}", m_part, p_value, significance_to_char(sign), mean_ctr, mean_case);
         m_total++;
@@ -80,36 +125,28 @@ namespace kmdiff {
 
           km::Kmer<KSIZE> kmer_ = kmer;
 
-          if (m_smat)
+          if (p_value <= m_significance)
           {
-            m_smat->template write<KSIZE, CMAX>(kmer_, counts);
+            if (m_smat)
+              m_smat->template write<KSIZE, CMAX>(kmer_, counts);
+
+            if (sign == Significance::CONTROL)
+              m_sign_controls++;
+            else
+              m_sign_cases++;
           }
 
           #ifndef WITH_POPSTRAT
             KmerSign<KSIZE> ks(std::move(kmer_), p_value, sign, mean_ctr, mean_case);
           #else
-            for (std::size_t i=0; i < counts.size(); i++) { m_counts[i] = counts[i]; }
-            KmerSign<KSIZE> ks(std::move(kmer_), p_value, sign, m_counts, mean_ctr, mean_case);
+            KmerSign<KSIZE> ks(std::move(kmer_), p_value, sign, sparse(counts), mean_ctr, mean_case);
           #endif
 
-          if (sign == Significance::CONTROL)
-            m_sign_controls++;
-          else
-            m_sign_cases++;
-
-          m_acc->push(std::move(ks));
+          this->push(std::move(ks));
           m_sign_kmer_per_part++;
         }
       }
 
-      std::size_t total() const { return m_total; }
-      std::size_t nb_sign() const { return m_sign_kmer_per_part; }
-
-      std::tuple<std::size_t, std::size_t> nb_signs() const
-      {
-        return std::make_tuple(m_sign_controls, m_sign_cases);
-      }
-
     protected:
       const std::shared_ptr<IModel<CMAX>> m_model {nullptr};
       std::size_t m_sign_kmer_per_part {0};
@@ -119,10 +156,13 @@ namespace kmdiff {
       std::size_t m_nb_controls {0};
       std::size_t m_nb_cases {0};
       std::size_t m_part {0};
-      std::vector<double> m_counts;
+      SparseCounts<count_type> m_sparse;
+      bool m_has_sparse {false};
       std::size_t m_sign_controls {0};
       std::size_t m_sign_cases {0};
       std::shared_ptr<km::MatrixWriter<65536>> m_smat;
+      ISparseModel<CMAX>* m_sparse_model {nullptr};
+      double m_significance {0};
   };
 
   template<std::size_t KSIZE, std::size_t CMAX>
@@ -142,40 +182,94 @@ namespace kmdiff {
 
       void process(km::Kmer<KSIZE>& kmer, std::vector<count_type>& counts) override
       {
-        Range<count_type> range_controls(counts, 0, this->m_nb_controls);
-        Range<count_type> range_cases(counts, this->m_nb_controls, this->m_nb_cases);
+        this->m_has_sparse = false;
+        m_sampler->sample(this->m_part, std::hash<km::Kmer<KSIZE>>{}(kmer), this->sparse(counts));
+        this->test(kmer, counts);
+      }
 
-        m_sampler->sample(range_controls, range_cases);
+    private:
+      std::shared_ptr<Sampler<CMAX>> m_sampler {nullptr};
+  };
 
-        auto [p_value, sign, mean_ctr, mean_case] = this->m_model->process(range_controls, range_cases);
-        //spdlog::debug("P{}: {} {} {} {}", this->m_part, p_value, significance_to_char(sign), mean_ctr, mean_case);
+#ifdef WITH_POPSTRAT
+  /*
+    Samples the k-mers for the PCA without testing them, the first pass of the fused popstrat
+    mode.
+  */
+  template<std::size_t KSIZE, std::size_t CMAX>
+  class sampling_observer : public diff_observer<KSIZE, CMAX>
+  {
+    using count_type = typename km::selectC<CMAX>::type;
+    public:
+      sampling_observer(std::size_t controls,
+                        std::size_t cases,
+                        std::shared_ptr<Sampler<CMAX>> sampler,
+                        std::size_t partition)
+        : diff_observer<KSIZE, CMAX>(nullptr, nullptr, 0, controls, cases, partition),
+          m_sampler(sampler) {}
 
+      void process(km::Kmer<KSIZE>& kmer, std::vector<count_type>& counts) override
+      {
+        this->m_has_sparse = false;
+        m_sampler->sample(this->m_part, std::hash<km::Kmer<KSIZE>>{}(kmer), this->sparse(counts));
         this->m_total++;
+      }
 
-        if (p_value <= this->m_threshold)
-        {
-          km::Kmer<KSIZE> kmer_ = kmer;
+    private:
+      std::shared_ptr<Sampler<CMAX>> m_sampler {nullptr};
+  };
 
-          #ifndef WITH_POPSTRAT
-            KmerSign<KSIZE> ks(std::move(kmer_), p_value, sign, mean_ctr, mean_case);
-          #else
-            for (std::size_t i=0; i < counts.size(); i++) { this->m_counts[i] = counts[i]; }
-            KmerSign<KSIZE> ks(std::move(kmer_), p_value, sign, this->m_counts, mean_ctr, mean_case);
-          #endif
+  /*
+    Corrects the significant k-mers while they are merged, by chunks of s_chunk_size, the second
+    pass of the fused popstrat mode. The accumulator receives the k-mers with their corrected
+    p-values, in merge order. The workspace belongs to the merge worker, not to the partition.
+  */
+  template<std::size_t KSIZE, std::size_t CMAX>
+  class diff_observer_pop : public diff_observer<KSIZE, CMAX>
+  {
+    public:
+      diff_observer_pop(const std::shared_ptr<IModel<CMAX>>& model,
+                        acc_t<KmerSign<KSIZE>> acc,
+                        double threshold,
+                        std::size_t controls,
+                        std::size_t cases,
+                        std::size_t partition,
+                        pop_strat_corrector_t pop,
+                        pop_strat_corrector::workspace& ws,
+                        std::shared_ptr<km::MatrixWriter<65536>> smat = nullptr)
+        : diff_observer<KSIZE, CMAX>(model, acc, threshold, controls, cases, partition, smat),
+          m_pop(pop),
+          m_ws(ws)
+      {
+        m_chunk.reserve(pop_strat_corrector::s_chunk_size);
+      }
+
+      void flush() override
+      {
+        if (m_chunk.empty())
+          return;
 
-          if (sign == Significance::CONTROL)
-            this->m_sign_controls++;
-          else
-            this->m_sign_cases++;
+        m_pop->correct(m_chunk.data(), m_chunk.size(), m_ws);
 
+        for (auto& ks : m_chunk)
           this->m_acc->push(std::move(ks));
-          this->m_sign_kmer_per_part++;
-        }
+        m_chunk.clear();
+      }
+
+    protected:
+      void push(KmerSign<KSIZE>&& ks) override
+      {
+        m_chunk.push_back(std::move(ks));
+        if (m_chunk.size() == pop_strat_corrector::s_chunk_size)
+          flush();
       }
 
     private:
-      std::shared_ptr<Sampler<CMAX>> m_sampler {nullptr};
+      pop_strat_corrector_t m_pop {nullptr};
+      pop_strat_corrector::workspace& m_ws;
+      std::vector<KmerSign<KSIZE>> m_chunk;
   };
+#endif
 
   template<std::size_t KSIZE, std::size_t CMAX>
   class matrix_proxy
@@ -231,16 +325,59 @@ namespace kmdiff {
           m_threshold(threshold),
           m_nb_threads(nb_threads),
           m_sampler(sampler),
-          m_smat_path(smat_path)
+          m_smat_path(smat_path),
+          m_significance(threshold)
       {}
 
+#ifdef WITH_POPSTRAT
+      // Fused popstrat mode: significant k-mers are corrected during the merge.
+      void set_pop_corrector(pop_strat_corrector_t pop) { m_pop = pop; }
+
+      // Fused popstrat mode: the k-mers are only sampled for the PCA.
+      void set_sampling_only(bool sampling_only) { m_sampling_only = sampling_only; }
+#endif
+
+      // Partitions flagged in skip are not merged, the others are committed to the manifest once
+      // their accumulator is finished, with the threshold as level. sorted tells whether the
+      // accumulators sort the k-mers by p-value.
+      void set_checkpoint(manifest_t manifest, const std::vector<std::uint8_t>& skip,
+                          bool sorted = false)
+      {
+        m_manifest = manifest;
+        m_skip = skip;
+        m_sorted = sorted;
+      }
+
+      // Sizes of the partitions when known, e.g. from a run manifest, instead of a stat per file.
+      void set_partition_sizes(const std::vector<std::uintmax_t>& sizes)
+      {
+        m_part_sizes = sizes;
+      }
+
+      // Called before a partition is merged, e.g. to check its count files, see check_partition.
+      void set_partition_check(std::function<void(std::size_t)> check) { m_check = check; }
+
+      // Level of the significant k-mers when the threshold is a retention level, see
+      // diff_observer::set_significance.
+      void set_significance(double level) { m_significance = level; }
+
+      // Pins the merge workers to cpus, see ThreadPool.
+      void set_pin_threads(bool pin) { m_pin_threads = pin; }
+
       std::size_t merge()
       {
-        ThreadPool pool(m_nb_threads);
+        ThreadPool pool(m_nb_threads, m_pin_threads);
         const std::size_t size = m_part_paths.size();
+        const std::vector<TaskPriority> priorities = partition_priorities(
+          m_part_sizes.size() == size ? m_part_sizes : partition_sizes(m_part_paths));
 
         std::vector<size_t> total_kmers(size);
 
+      #ifdef WITH_POPSTRAT
+        m_workspaces.clear();
+        m_workspaces.resize(pool.size());
+      #endif
+
         m_nb_signs.resize(size, 0);
         m_sign_controls.resize(size, 0);
         m_sign_cases.resize(size, 0);
@@ -251,42 +388,36 @@ namespace kmdiff {
 
         if ((spdlog::get_level() != spdlog::level::debug) && isatty_stderr())
         {
-          pb = get_progress_bar("progress", size, 50, indicators::Color::white, false);
+          pb = get_progress_bar("progress", size - nb_skipped(), 50, indicators::Color::white, false);
           pb->set_progress(0);
           pb->print_progress();
         }
 
         for (std::size_t p = 0; p < size; p++)
         {
+          if (skipped(p))
+            continue;
+
           auto partition_merger = [&ep, &total_kmers, p, pb, this](int id) {
             spdlog::debug("Process partition {}.", p);
             Timer mp_timer;
 
-            km::KmerMerger<KSIZE, CMAX> km_merge(
-              this->m_part_paths[p], this->m_ab_thresholds, this->m_kmer_size, 1, 0);
-
-            km::imo_t<KSIZE, CMAX> diff {nullptr};
+            km::imo_t<KSIZE, CMAX> diff = this->make_observer(p, id);
 
-            std::shared_ptr<km::MatrixWriter<65536>> smat = nullptr;
+            bool merged = false;
 
-            if (!this->m_smat_path.empty())
+            try
             {
-              std::string mpath = fmt::format("{}/matrix_{}.count.lz4", m_smat_path, p);
-              smat = std::make_shared<km::MatrixWriter<65536>>(
-                mpath , this->m_kmer_size, 4, this->m_controls + this->m_cases, 0, p, true
-              );
+              if (this->m_check)
+                this->m_check(p);
+
+              km::KmerMerger<KSIZE, CMAX> km_merge(
+                this->m_part_paths[p], this->m_ab_thresholds, this->m_kmer_size, 1, 0);
+              km_merge.merge(diff);
+              dynamic_cast<diff_observer<KSIZE, CMAX>*>(diff.get())->flush();
+              merged = true;
             }
-
-            if (!m_sampler)
-              diff = std::make_shared<diff_observer<KSIZE, CMAX>>(
-                this->m_model, this->m_accs[p], this->m_threshold,
-                this->m_controls, this->m_cases, p, smat);
-            else
-              diff = std::make_shared<diff_observer_strat<KSIZE, CMAX>>(
-                this->m_model, this->m_accs[p], this->m_threshold,
-                this->m_controls, this->m_cases, this->m_sampler, p);
-
-            try { km_merge.merge(diff); } catch (...) { ep = std::current_exception(); }
+            catch (...) { ep = std::current_exception(); }
 
             total_kmers[p] = dynamic_cast<diff_observer<KSIZE, CMAX>*>(diff.get())->total();
             this->m_nb_signs[p] = dynamic_cast<diff_observer<KSIZE, CMAX>*>(diff.get())->nb_sign();
@@ -296,14 +427,25 @@ namespace kmdiff {
             this->m_sign_controls[p] += co;
             this->m_sign_cases[p] += ca;
 
-            this->m_accs[p]->finish();
+            if (this->m_accs[p])
+            {
+              if (merged)
+                this->m_accs[p]->finish();
+              else
+                this->m_accs[p]->abort();
+            }
+
+            if (merged && this->m_manifest)
+              this->m_manifest->commit(p, {this->m_nb_signs[p], total_kmers[p], co, ca,
+                                          this->m_accs[p] ? this->m_accs[p]->checksum() : 0,
+                                          this->m_threshold, this->m_sorted});
 
             spdlog::debug("Partition {} processed. ({})", p, mp_timer.formatted());
             if (pb)
               pb->tick();
           };
 
-          pool.add_task(partition_merger);
+          pool.add_task(partition_merger, priorities[p]);
         }
 
         pool.join_all();
@@ -318,11 +460,21 @@ namespace kmdiff {
 
       std::size_t merge(const std::vector<std::string>& paths)
       {
-        ThreadPool pool(m_nb_threads);
+        ThreadPool pool(m_nb_threads, m_pin_threads);
         const std::size_t size = paths.size();
 
+        std::vector<std::vector<std::string>> files;
+        for (auto& path : paths)
+          files.push_back({path});
+        const std::vector<TaskPriority> priorities = partition_priorities(partition_sizes(files));
+
         std::vector<size_t> total_kmers(size);
 
+      #ifdef WITH_POPSTRAT
+        m_workspaces.clear();
+        m_workspaces.resize(pool.size());
+      #endif
+
         m_nb_signs.resize(size, 0);
         m_sign_controls.resize(size, 0);
         m_sign_cases.resize(size, 0);
@@ -333,41 +485,33 @@ namespace kmdiff {
 
         if ((spdlog::get_level() != spdlog::level::debug) && isatty_stderr())
         {
-          pb = get_progress_bar("progress", size, 50, indicators::Color::white, false);
+          pb = get_progress_bar("progress", size - nb_skipped(), 50, indicators::Color::white, false);
           pb->set_progress(0);
           pb->print_progress();
         }
 
         for (std::size_t p = 0; p < size; p++)
         {
+          if (skipped(p))
+            continue;
+
           auto partition_merger = [&ep, &total_kmers, p, pb, paths, this](int id) {
             spdlog::debug("Process partition {}.", p);
             Timer mp_timer;
 
             matrix_proxy<KSIZE, CMAX> km_merge(paths[p], m_controls + m_cases);
 
-            km::imo_t<KSIZE, CMAX> diff {nullptr};
+            km::imo_t<KSIZE, CMAX> diff = this->make_observer(p, id);
 
-            std::shared_ptr<km::MatrixWriter<65536>> smat = nullptr;
+            bool merged = false;
 
-            if (!this->m_smat_path.empty())
+            try
             {
-              std::string mpath = fmt::format("{}/matrix_{}.count.lz4", m_smat_path, p);
-              smat = std::make_shared<km::MatrixWriter<65536>>(
-                mpath , this->m_kmer_size, 4, this->m_controls + this->m_cases, 0, p, true
-              );
+              km_merge.merge(diff);
+              dynamic_cast<diff_observer<KSIZE, CMAX>*>(diff.get())->flush();
+              merged = true;
             }
-
-            if (!m_sampler)
-              diff = std::make_shared<diff_observer<KSIZE, CMAX>>(
-                this->m_model, this->m_accs[p], this->m_threshold,
-                this->m_controls, this->m_cases, p, smat);
-            else
-              diff = std::make_shared<diff_observer_strat<KSIZE, CMAX>>(
-                this->m_model, this->m_accs[p], this->m_threshold,
-                this->m_controls, this->m_cases, this->m_sampler, p);
-
-            try { km_merge.merge(diff); } catch (...) { ep = std::current_exception(); }
+            catch (...) { ep = std::current_exception(); }
 
             total_kmers[p] = dynamic_cast<diff_observer<KSIZE, CMAX>*>(diff.get())->total();
             this->m_nb_signs[p] = dynamic_cast<diff_observer<KSIZE, CMAX>*>(diff.get())->nb_sign();
@@ -377,14 +521,25 @@ namespace kmdiff {
             this->m_sign_controls[p] += co;
             this->m_sign_cases[p] += ca;
 
-            this->m_accs[p]->finish();
+            if (this->m_accs[p])
+            {
+              if (merged)
+                this->m_accs[p]->finish();
+              else
+                this->m_accs[p]->abort();
+            }
+
+            if (merged && this->m_manifest)
+              this->m_manifest->commit(p, {this->m_nb_signs[p], total_kmers[p], co, ca,
+                                          this->m_accs[p] ? this->m_accs[p]->checksum() : 0,
+                                          this->m_threshold, this->m_sorted});
 
             spdlog::debug("Partition {} processed. ({})", p, mp_timer.formatted());
             if (pb)
               pb->tick();
           };
 
-          pool.add_task(partition_merger);
+          pool.add_task(partition_merger, priorities[p]);
         }
 
         pool.join_all();
@@ -399,6 +554,61 @@ namespace kmdiff {
 
 
 
+    private:
+      bool skipped(std::size_t p) const
+      {
+        return p < m_skip.size() && m_skip[p];
+      }
+
+      std::size_t nb_skipped() const
+      {
+        return std::count_if(m_skip.begin(), m_skip.end(), [](std::uint8_t s) { return s; });
+      }
+
+      km::imo_t<KSIZE, CMAX> make_observer(std::size_t p, int worker)
+      {
+      #ifdef WITH_POPSTRAT
+        if (m_sampling_only)
+          return std::make_shared<sampling_observer<KSIZE, CMAX>>(
+            m_controls, m_cases, m_sampler, p);
+      #endif
+
+        std::shared_ptr<km::MatrixWriter<65536>> smat = nullptr;
+
+        if (!m_smat_path.empty())
+        {
+          std::string mpath = fmt::format("{}/matrix_{}.count.lz4", m_smat_path, p);
+          smat = std::make_shared<km::MatrixWriter<65536>>(
+            mpath , m_kmer_size, 4, m_controls + m_cases, 0, p, true
+          );
+        }
+
+        std::shared_ptr<diff_observer<KSIZE, CMAX>> obs = nullptr;
+
+      #ifdef WITH_POPSTRAT
+        if (m_pop)
+        {
+          // A worker merges one partition at a time, its workspace and cache outlive them.
+          auto& ws = m_workspaces[worker];
+          if (!ws)
+            ws = std::make_unique<pop_strat_corrector::workspace>(*m_pop);
+          obs = std::make_shared<diff_observer_pop<KSIZE, CMAX>>(
+            m_model, m_accs[p], m_threshold, m_controls, m_cases, p, m_pop, *ws, smat);
+        }
+        else
+      #endif
+        if (!m_sampler)
+          obs = std::make_shared<diff_observer<KSIZE, CMAX>>(
+            m_model, m_accs[p], m_threshold, m_controls, m_cases, p, smat);
+        else
+          obs = std::make_shared<diff_observer_strat<KSIZE, CMAX>>(
+            m_model, m_accs[p], m_threshold, m_controls, m_cases, m_sampler, p);
+
+        obs->set_significance(m_significance);
+        return obs;
+      }
+
+    public:
       size_t nb_sign() const
       {
         return std::accumulate(m_nb_signs.begin(), m_nb_signs.end(), 0ULL);
@@ -412,6 +622,36 @@ namespace kmdiff {
         );
       }
 
+      private:
+        static std::vector<std::uintmax_t> partition_sizes(
+          const std::vector<std::vector<std::string>>& partitions)
+        {
+          std::vector<std::uintmax_t> sizes(partitions.size(), 0);
+          for (std::size_t p = 0; p < partitions.size(); p++)
+          {
+            for (auto& path : partitions[p])
+            {
+              std::error_code ec;
+              std::uintmax_t s = std::filesystem::file_size(path, ec);
+              if (!ec) sizes[p] += s;
+            }
+          }
+          return sizes;
+        }
+
+        // Partitions larger than the mean are scheduled first, so the largest ones do not end up
+        // as the tail of the merge.
+        static std::vector<TaskPriority> partition_priorities(const std::vector<std::uintmax_t>& sizes)
+        {
+          double mean = sizes.empty() ? 0 :
+            std::accumulate(sizes.begin(), sizes.end(), 0.0) / sizes.size();
+
+          std::vector<TaskPriority> priorities;
+          for (auto s : sizes)
+            priorities.push_back(s > mean ? TaskPriority::HIGH : TaskPriority::NORMAL);
+          return priorities;
+        }
+
       private:
         std::vector<std::vector<std::string>>& m_part_paths;
         std::vector<std::uint32_t> m_ab_thresholds;
@@ -429,6 +669,20 @@ namespace kmdiff {
 
         std::shared_ptr<Sampler<CMAX>> m_sampler {nullptr};
         const std::string m_smat_path;
+
+        manifest_t m_manifest {nullptr};
+        std::vector<std::uint8_t> m_skip;
+        bool m_sorted {false};
+        std::vector<std::uintmax_t> m_part_sizes;
+        double m_significance {0};
+        std::function<void(std::size_t)> m_check;
+        bool m_pin_threads {false};
+
+      #ifdef WITH_POPSTRAT
+        pop_strat_corrector_t m_pop {nullptr};
+        bool m_sampling_only {false};
+        std::vector<std::unique_ptr<pop_strat_corrector::workspace>> m_workspaces;
+      #endif
   };
 
 } // end of namespace kmdiff
@@ -92,7 +92,7 @@ namespace kmdiff {
   };
 
   template <size_t MAX_C>
-  class PoissonLikelihood : public IModel<MAX_C>, public Model<MAX_C>
+  class PoissonLikelihood : public IModel<MAX_C>, public ISparseModel<MAX_C>, public Model<MAX_C>
   {
   /*
     Based on https://github.com/atifrahman/HAWK
@@ -142,9 +142,21 @@ namespace kmdiff {
     std::tuple<double, Significance, double, double>
     process(const Range<count_t>& controls, const Range<count_t>& cases) override
     {
-      auto [mean_control, positive_controls] = this->compute_sum_e(controls);
-      auto [mean_case, positive_cases] = this->compute_sum_e(cases);
+      auto [sum_control, positive_controls] = this->compute_sum_e(controls);
+      auto [sum_case, positive_cases] = this->compute_sum_e(cases);
 
+      return test(sum_control, sum_case);
+    }
+
+    // The likelihoods only depend on the sums of the counts.
+    model_ret_t process_sparse(const SparseCounts<count_t>& counts) override
+    {
+      return test(counts.sum_controls(), counts.sum_cases());
+    }
+
+   private:
+    model_ret_t test(double mean_control, double mean_case)
+    {
       double mean = (mean_control + mean_case) / static_cast<double>(m_sum_controls + m_sum_cases);
 
       double null_hypothesis = 0;
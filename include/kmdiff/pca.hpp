@@ -0,0 +1,108 @@
+/*****************************************************************************
+ *   kmdiff
+ *   Authors: T. Lemane
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// int
+#include <kmdiff/linear_model.hpp>
+
+namespace kmdiff {
+
+  // Size of a record in EIGENSOFT packed genotype files: 2 bits per sample, at least 48 bytes.
+  std::size_t eig_record_size(std::size_t nb_samples);
+
+  // Genotype matrix of the k-mers sampled for the pca, one row per k-mer. Rows are kept as
+  // EIGENSOFT packed records (2 bits per sample, 3 means missing) whatever the format of the
+  // file, packed or text.
+  class geno_matrix
+  {
+    public:
+      geno_matrix(const std::string& path, std::size_t nb_samples);
+
+      std::size_t rows() const { return m_rows; }
+      std::size_t cols() const { return m_cols; }
+
+      const std::uint8_t* operator[](std::size_t i) const { return m_data.data() + i * m_record; }
+
+      static std::uint8_t at(const std::uint8_t* row, std::size_t j)
+      {
+        return (row[j >> 2] >> (6 - 2 * (j & 3))) & 3;
+      }
+
+    private:
+      void load_packed(std::ifstream& in, const std::string& path);
+      void load_text(std::ifstream& in, const std::string& path);
+
+    private:
+      std::size_t m_cols {0};
+      std::size_t m_rows {0};
+      std::size_t m_record {0};
+      std::vector<std::uint8_t> m_data;
+  };
+
+  struct pca_result
+  {
+    vector_t eigenvalues;
+    matrix_t eigenvectors; // nb_samples x npc, unit columns
+  };
+
+  // Pca of the sample covariance XᵀX/M, where X is the genotype matrix with rows centered and
+  // scaled by sqrt(p(1-p)) as smartpca does with 'usenorm: YES'. The leading eigenvectors are
+  // computed by randomized subspace iteration, so X is only read through XᵀXQ products, which
+  // are split in row slices across threads. The slices do not depend on the number of threads,
+  // and the results neither.
+  class randomized_pca
+  {
+    public:
+      inline static std::size_t s_oversampling = 10;
+      inline static std::size_t s_power_iterations = 4;
+      inline static std::size_t s_nb_slices = 64;
+
+      randomized_pca(const geno_matrix& geno, std::size_t ploidy, std::size_t nb_threads);
+
+      pca_result run(std::size_t npc, std::uint64_t seed = 0) const;
+
+    private:
+      // res = XᵀX q
+      void covariance_product(const dense_matrix& q, dense_matrix& res) const;
+
+    private:
+      const geno_matrix& m_geno;
+      std::size_t m_nb_threads {1};
+
+      // Normalized value of each genotype (0, 1, 2, missing) for each row.
+      std::vector<double> m_values;
+  };
+
+  // Orthonormalizes the columns of m in place (modified Gram-Schmidt), columns with no
+  // component left are zeroed.
+  void orthonormalize(dense_matrix& m);
+
+  // Eigen decomposition of a symmetric matrix (cyclic Jacobi), eigenvalues in decreasing order
+  // and eigenvectors as columns of vectors.
+  void symmetric_eigen(const dense_matrix& m, vector_t& values, dense_matrix& vectors);
+
+  void write_evec(const std::string& path, const pca_result& pca);
+
+} // end of namespace kmdiff
@@ -4,11 +4,14 @@
 #include <string>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <vector>
 #include <tuple>
 #include <mutex>
-#include <random>
+#include <atomic>
+#include <algorithm>
+#include <numeric>
 
 // ext
 #include <fmt/format.h>
@@ -20,26 +23,13 @@
 #include <kmdiff/kmer.hpp>
 #include <kmdiff/model.hpp>
 #include <kmdiff/linear_model.hpp>
-#include <kmdiff/spinlock.hpp>
+#include <kmdiff/pca.hpp>
 #include <kmdiff/progress.hpp>
 #include <kmdiff/threadpool.hpp>
 #include <kmdiff/accumulator.hpp>
 
-const std::map<std::string, std::string> parfile_map = {
-  {"genotypename", "gwas_eigenstratX.geno"},
-  {"snpname", "gwas_eigenstratX.snp"},
-  {"indivname", "gwas_eigenstratX.ind"},
-  {"evecoutname", "gwas_eigenstrat.evec"},
-  {"evaloutname", "gwas_eigenstrat.eval"},
-  {"usenorm", "YES"},
-  {"numoutlieriter", "0"},
-  {"numoutevec", "10"},
-};
-
 namespace kmdiff {
 
-  void write_parfile(const std::string& path);
-
   void write_gwas_info(const std::string& kmfof, const std::string& path,
                        size_t nb_controls, size_t nb_cases, const std::string& gender_file);
 
@@ -47,38 +37,20 @@ namespace kmdiff {
                                    const std::vector<std::size_t>& c1,
                                    const std::vector<std::size_t>& c2);
 
-  void run_eigenstrat_smartpca(const std::string& popstrat_dir,
-                               const std::string& parfile,
-                               const std::string& log,
-                               bool is_diploid,
-                               std::size_t n);
-  template<size_t MAX_C>
-  class EigGenoFile
-  {
-    using ctype = typename km::selectC<MAX_C>::type;
-  public:
-    EigGenoFile(const std::string& path)
-      : m_path(path), m_out(m_path, std::ios::out)
-    {
-      check_fstream_good(m_path, m_out);
-    }
-    void push(const Range<ctype>& controls, const Range<ctype>& cases)
-    {
-      for (auto& c : controls)
-        m_out << (c > 0 ? "1\t" : "0\t");
-      for (auto& c : cases)
-        m_out << (c > 0 ? "1\t" : "0\t");
-      m_out << "\n";
-    }
-
-    void close() { m_out.close(); }
-  private:
-    std::string m_path;
-    std::ofstream m_out;
-  };
-
-  template<size_t MAX_C>
-  using eig_geno_t = std::shared_ptr<EigGenoFile<MAX_C>>;
+  // EIGENSOFT name hashes, stored in the header of packed files and checked against the .ind
+  // and .snp files. eig_snp_hash(n) is the hash of the snp names written by EigSnpFile.
+  std::uint32_t eig_hash(const std::vector<std::string>& names);
+  std::uint32_t eig_snp_hash(std::size_t nb_snps);
+
+  // Content key of the principal components of a run. They only depend on the run, its samples
+  // and their totals, and the sampling parameters, so runs with the same key can share them.
+  std::uint64_t pca_key(std::uint64_t run,
+                        const std::vector<std::string>& samples,
+                        const std::vector<std::size_t>& control_totals,
+                        const std::vector<std::size_t>& case_totals,
+                        double kmer_pca,
+                        std::size_t seed,
+                        std::size_t ploidy);
 
   class EigSnpFile
   {
@@ -105,44 +77,179 @@ namespace kmdiff {
 
   using eig_snp_t = std::shared_ptr<EigSnpFile>;
 
+  // Samples k-mers for the pca. Each partition is processed by a single task and owns its
+  // buffer, so sampling takes no lock. Buffers larger than s_buffer_size are spilled to
+  // per-partition files, which are concatenated in partition order by close().
+  // Rows are written in the EIGENSOFT packed format (2 bits per sample, one record of
+  // eig_record_size() bytes per k-mer after a header record) unless text output is requested.
   template<size_t MAX_C>
   class Sampler
   {
     using count_type = typename km::selectC<MAX_C>::type;
 
+    static constexpr std::size_t s_buffer_size = 1 << 20;
+
     public:
-      Sampler(eig_geno_t<MAX_C> geno, eig_snp_t snp, double v, std::size_t seed = 0)
-        : m_geno(geno), m_snp(snp), m_v(v)
+      Sampler(const std::string& geno_path,
+              const std::string& snp_path,
+              const std::vector<std::string>& individuals,
+              std::size_t nb_partitions,
+              double v,
+              std::size_t seed = 0,
+              bool text = false)
+        : m_geno_path(geno_path),
+          m_snp_path(snp_path),
+          m_nb_samples(individuals.size()),
+          m_ihash(eig_hash(individuals)),
+          m_text(text),
+          m_row_size(text ? individuals.size() * 2 + 1 : eig_record_size(individuals.size())),
+          m_buffers(nb_partitions),
+          m_rows(nb_partitions, 0),
+          m_spilled(nb_partitions, false),
+          m_v(v),
+          m_seed(seed)
+      {}
+
+      // Counter-based draw: the decision only depends on the seed, the partition and the k-mer,
+      // so the sampled set is the same whatever the number of threads.
+      bool sample(std::size_t partition, std::uint64_t hash) const
       {
-        if (seed)
-          m_gen.seed(seed);
+        std::uint64_t x = mix(m_seed ^ mix(partition ^ mix(hash)));
+        return static_cast<double>(x >> 11) * 0x1.0p-53 < m_v;
       }
 
-      bool sample()
+      // Only the samples where the k-mer is present are visited in packed rows.
+      void sample(std::size_t partition,
+                  std::uint64_t hash,
+                  const SparseCounts<count_type>& counts)
       {
-        return m_dist(m_gen) < m_v;
+        if (!sample(partition, hash))
+          return;
+
+        std::string& buffer = m_buffers[partition];
+
+        if (m_text)
+        {
+          std::size_t offset = buffer.size();
+          buffer.resize(offset + counts.size() * 2 + 1);
+          char* row = buffer.data() + offset;
+
+          for (std::size_t i = 0; i < counts.size(); i++)
+          {
+            row[2 * i] = '0';
+            row[2 * i + 1] = '\t';
+          }
+          for (auto i : counts.index())
+            row[2 * i] = '1';
+          row[counts.size() * 2] = '\n';
+        }
+        else
+        {
+          std::size_t offset = buffer.size();
+          buffer.resize(offset + m_row_size, '\0');
+          char* row = buffer.data() + offset;
+
+          for (auto i : counts.index())
+            set_bit(row, i, true);
+        }
+
+        m_rows[partition]++;
+
+        if (buffer.size() >= s_buffer_size)
+          spill(partition);
       }
 
-      void sample(const Range<count_type>& r1, const Range<count_type>& r2)
+      void close()
       {
-        std::unique_lock<spinlock> lock(m_lock);
+        std::ofstream geno(m_geno_path, std::ios::out | std::ios::binary);
+        check_fstream_good(m_geno_path, geno);
 
-        if (!sample())
-          return;
+        std::size_t nb_rows = std::accumulate(m_rows.begin(), m_rows.end(), std::size_t{0});
+
+        if (!m_text)
+        {
+          std::string header(m_row_size, '\0');
+          std::string h = fmt::format(
+            "GENO {:7} {:7} {:x} {:x}", m_nb_samples, nb_rows, m_ihash, eig_snp_hash(nb_rows));
+          header.replace(0, h.size(), h);
+          geno.write(header.data(), header.size());
+        }
+
+        EigSnpFile snp(m_snp_path);
+
+        for (std::size_t p = 0; p < m_buffers.size(); p++)
+        {
+          if (m_spilled[p])
+          {
+            spill(p);
+            std::string path = part_path(p);
+            {
+              std::ifstream in(path, std::ios::in | std::ios::binary);
+              check_fstream_good(path, in);
+              geno << in.rdbuf();
+            }
+            fs::remove(path);
+          }
+          else
+          {
+            geno.write(m_buffers[p].data(), m_buffers[p].size());
+          }
+
+          std::string().swap(m_buffers[p]);
 
-        m_geno->push(r1, r2);
-        m_snp->push();
+          for (std::size_t i = 0; i < m_rows[p]; i++)
+            snp.push();
+        }
+
+        snp.close();
       }
 
     private:
-      std::default_random_engine m_gen;
-      std::uniform_real_distribution<double> m_dist {0.0, 1.0};
+      static std::uint64_t mix(std::uint64_t x)
+      {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+      }
 
-      eig_geno_t<MAX_C> m_geno {nullptr};
-      eig_snp_t m_snp {nullptr};
-      double m_v {0.0};
+      // Sample i takes the bits 7-2*(i%4) and 6-2*(i%4) of byte i/4.
+      static void set_bit(char* row, std::size_t i, bool present)
+      {
+        if (present)
+          row[i >> 2] |= static_cast<char>(1 << (6 - 2 * (i & 3)));
+      }
+
+      std::string part_path(std::size_t partition) const
+      {
+        return fmt::format("{}.p{}", m_geno_path, partition);
+      }
+
+      void spill(std::size_t partition)
+      {
+        std::string path = part_path(partition);
+        std::ofstream out(
+          path, std::ios::binary | (m_spilled[partition] ? std::ios::app : std::ios::out));
+        check_fstream_good(path, out);
+        out.write(m_buffers[partition].data(), m_buffers[partition].size());
+        m_buffers[partition].clear();
+        m_spilled[partition] = true;
+      }
+
+    private:
+      std::string m_geno_path;
+      std::string m_snp_path;
+      std::size_t m_nb_samples {0};
+      std::uint32_t m_ihash {0};
+      bool m_text {false};
+      std::size_t m_row_size {0};
+
+      std::vector<std::string> m_buffers;
+      std::vector<std::size_t> m_rows;
+      std::vector<std::uint8_t> m_spilled;
 
-      spinlock m_lock;
+      double m_v {0.0};
+      std::uint64_t m_seed {0};
   };
 
   class pop_strat_corrector
@@ -154,6 +261,12 @@ namespace kmdiff {
       inline static double s_epsilon = 1e-30;
       inline static bool s_stand = true;
       inline static bool s_irls = false;
+      inline static PopTest s_test = PopTest::LRT;
+      inline static bool s_refit = false;
+      inline static double s_screen = 0.05;
+
+      static constexpr std::size_t s_batch_size = 32;
+      static constexpr std::size_t s_chunk_size = 4096;
 
       static constexpr char s_m = 'M';
       static constexpr char s_f = 'F';
@@ -177,6 +290,15 @@ namespace kmdiff {
           pop_strat_corrector::s_irls = irls;
       }
 
+      // With PopTest::SCORE and refit, the k-mers with a score p-value <= screen are refitted
+      // with the LRT.
+      static void set_test(PopTest test, bool refit, double screen)
+      {
+        pop_strat_corrector::s_test = test;
+        pop_strat_corrector::s_refit = refit;
+        pop_strat_corrector::s_screen = screen;
+      }
+
     public:
       pop_strat_corrector(std::size_t nb_controls, std::size_t nb_cases,
                           const vector_ull_t& control_totals,
@@ -184,21 +306,48 @@ namespace kmdiff {
                           std::size_t npc);
 
       void load_Z(const std::string& path);
+      void set_Z(const matrix_t& z);
       void load_Y(const std::string& path);
       void load_C(const std::string& path);
       void load_ginfo(const std::string& path);
       void init_global_features();
 
+      /*
+        The significant k-mers are read by chunks of s_chunk_size, partition after partition.
+        Chunks are corrected by all the threads, whatever their partition, and written back to
+        the pop accumulator of their partition in reading order, so that the correction scales
+        with cores rather than with the skew of the partitions. Partitions already done in the
+        manifest, or without input in a shard, are skipped, the others are committed to the
+        manifest once written.
+      */
       template<size_t KSIZE>
       void apply(std::vector<acc_t<KmerSign<KSIZE>>>& accumulators,
                  std::vector<acc_t<KmerSign<KSIZE>>>& pop_accumulators,
-                 std::size_t nb_threads)
+                 std::size_t nb_threads,
+                 manifest_t manifest = nullptr,
+                 bool pin_threads = false)
       {
+        using chunk_t = std::vector<KmerSign<KSIZE>>;
+
+        struct partition_state
+        {
+          std::mutex read_mutex;
+          std::size_t next_read {0};
+          bool exhausted {false};
+          std::size_t nb_chunks {0};
+
+          std::mutex write_mutex;
+          std::size_t next_write {0};
+          std::map<std::size_t, std::pair<chunk_t, std::size_t>> pending;
+        };
+
         const auto size = accumulators.size();
 
-        ThreadPool pool(nb_threads > size ? size : nb_threads);
+        ThreadPool pool(nb_threads, pin_threads);
 
         std::exception_ptr ep = nullptr;
+        std::mutex ep_mutex;
+        std::atomic<bool> abort {false};
 
         indicators::ProgressBar* pb = nullptr;
 
@@ -209,27 +358,132 @@ namespace kmdiff {
           pb->print_progress();
         }
 
+        std::vector<partition_state> states(size);
+        std::atomic<std::size_t> cursor {0};
+
         for (std::size_t p = 0; p < size; p++)
         {
-          auto worker = [&acc = accumulators[p], &pacc = pop_accumulators[p], this, pb, &ep](int id) {
+          if (!(manifest && manifest->done(p)) && accumulators[p])
+            continue;
+
+          states[p].exhausted = true;
+          if (accumulators[p])
+            accumulators[p]->destroy();
+          if (pb)
+            pb->tick();
+        }
 
-            try
-            {
-              while (auto& oks = acc->get())
-              {
-                //spdlog::debug(oks.value().to_string());
+        std::atomic<std::size_t> cache_hits {0};
+        std::atomic<std::size_t> cache_lookups {0};
+
+        // Chunks written back are recycled, which keeps the capacity of their KmerSign.
+        std::mutex free_mutex;
+        std::vector<chunk_t> free_chunks;
+
+        auto take_chunk = [&]() {
+          std::unique_lock<std::mutex> lock(free_mutex);
+          if (free_chunks.empty())
+            return chunk_t(s_chunk_size);
+          chunk_t chunk = std::move(free_chunks.back());
+          free_chunks.pop_back();
+          return chunk;
+        };
+
+        auto commit = [&](std::size_t p, std::size_t seq, chunk_t&& chunk, std::size_t n) {
+          partition_state& state = states[p];
+          std::unique_lock<std::mutex> lock(state.write_mutex);
+          state.pending.emplace(seq, std::make_pair(std::move(chunk), n));
+
+          for (auto it = state.pending.begin();
+               it != state.pending.end() && it->first == state.next_write;
+               it = state.pending.erase(it))
+          {
+            auto& [c, cn] = it->second;
+            for (std::size_t k = 0; k < cn; k++)
+              pop_accumulators[p]->push(std::move(c[k]));
+            state.next_write++;
 
-                this->apply(oks.value());
-                auto coks = oks.value();
-                pacc->push(std::move(coks));
-              }
-            } catch (...) { ep = std::current_exception(); }
+            std::unique_lock<std::mutex> flock(free_mutex);
+            free_chunks.push_back(std::move(c));
+          }
 
-            acc->destroy();
-            pacc->finish();
+          bool done;
+          {
+            std::unique_lock<std::mutex> rlock(state.read_mutex);
+            done = state.exhausted && state.next_write == state.nb_chunks;
+          }
+
+          if (done)
+          {
+            accumulators[p]->destroy();
+            pop_accumulators[p]->finish();
+
+            if (manifest)
+              manifest->commit(p, {pop_accumulators[p]->size(), 0, 0, 0,
+                                   pop_accumulators[p]->checksum()});
 
             if (pb)
               pb->tick();
+          }
+        };
+
+        for (std::size_t t = 0; t < pool.size(); t++)
+        {
+          auto worker = [&, this](int id) {
+            workspace ws(*this);
+
+            while (!abort)
+            {
+              std::size_t p = cursor;
+              if (p >= size)
+                break;
+
+              partition_state& state = states[p];
+              chunk_t chunk;
+              std::size_t n = 0;
+              std::size_t seq = 0;
+
+              try
+              {
+                std::unique_lock<std::mutex> lock(state.read_mutex);
+                if (state.exhausted)
+                {
+                  lock.unlock();
+                  cursor.compare_exchange_strong(p, p + 1);
+                  continue;
+                }
+
+                chunk = take_chunk();
+                while (n < s_chunk_size)
+                {
+                  auto& oks = accumulators[p]->get();
+                  if (!oks)
+                    break;
+                  chunk[n++] = oks.value();
+                }
+
+                seq = state.next_read++;
+                if (n < s_chunk_size)
+                {
+                  state.exhausted = true;
+                  state.nb_chunks = state.next_read;
+                }
+                lock.unlock();
+
+                this->correct(chunk.data(), n, ws);
+
+                commit(p, seq, std::move(chunk), n);
+              }
+              catch (...)
+              {
+                std::unique_lock<std::mutex> lock(ep_mutex);
+                if (ep == nullptr) ep = std::current_exception();
+                abort = true;
+              }
+            }
+
+            cache_hits += ws.hits;
+            cache_lookups += ws.lookups;
           };
 
           pool.add_task(worker);
@@ -240,98 +494,245 @@ namespace kmdiff {
 
         if (ep != nullptr)
           rethrow_exception(ep);
+
+        spdlog::info("Popstrat cache: {}/{} k-mers reused their count vector p-value ({:.1f}%).",
+                     cache_hits.load(), cache_lookups.load(),
+                     cache_lookups ? 100.0 * cache_hits / cache_lookups : 0.0);
       }
 
     private:
 
-      void standardize();
-
-      template<std::size_t KSIZE>
-      void apply(KmerSign<KSIZE>& ks)
+      // Direct-mapped cache of corrected p-values, indexed by a 128-bit fingerprint of the count
+      // vector. K-mers of a same variant usually share their counts, and so their p-value.
+      class pval_cache
       {
-        matrix_t local_features(m_alt_global_features);
+        public:
+          using key_t = std::pair<std::uint64_t, std::uint64_t>;
 
-        for (std::size_t i = 0; i < m_size; i++)
-        {
-          local_features[i][m_alt_feature_count - 1] = ks.m_counts_ratio[i] / m_totals[i];
-        }
+          static constexpr std::size_t s_size = 1 << 16;
 
-        #ifdef KMD_USE_IRLS
-          auto [model, singular, nan, error, iter] = glm_irls(
-            local_features, m_Y, s_max_iter);
-        #else
-          auto [model, singular, nan, error, iter] = glm_newton_raphson(
-            local_features, m_Y, s_learn_rate, s_max_iter);
-        #endif
-
-        double alt_likelihood = 1.0;
-
-        for (std::size_t f = 0; f < nrows(local_features); f++)
-        {
-          vector_t data(ncols(local_features));
-
-          for (std::size_t i = 0; i < ncols(local_features); i++)
+          static key_t key(const SparseCounts<kmer_count_t>& counts)
           {
-            data[i] = local_features[f][i];
+            const auto& index = counts.index();
+            const auto& value = counts.value();
+            const std::size_t ibytes = index.size() * sizeof(std::uint32_t);
+            const std::size_t vbytes = value.size() * sizeof(kmer_count_t);
+
+            key_t k {counts.size(), counts.size() ^ 0x9e3779b97f4a7c15ULL};
+            k.first = XXH64(value.data(), vbytes, XXH64(index.data(), ibytes, k.first));
+            k.second = XXH64(value.data(), vbytes, XXH64(index.data(), ibytes, k.second));
+            return k;
           }
-          double p = predict(model, data);
 
-          if (m_Y[f] == 1)
+          bool find(const key_t& k, double& pval) const
           {
-            alt_likelihood = alt_likelihood * p;
+            const entry& e = m_entries[k.first & (s_size - 1)];
+            if (!e.used || e.key != k)
+              return false;
+            pval = e.pval;
+            return true;
           }
-          else
+
+          void insert(const key_t& k, double pval)
           {
-            alt_likelihood *= 1.0 - p;
+            m_entries[k.first & (s_size - 1)] = {k, pval, true};
           }
-        }
 
-        double null_likelihood = 1.0;
+        private:
+          struct entry
+          {
+            key_t key {0, 0};
+            double pval {0};
+            bool used {false};
+          };
+
+          std::vector<entry> m_entries = std::vector<entry>(s_size);
+      };
+
+    public:
+      // Per-thread buffers of the correction, sized by the first k-mers and then reused, so that
+      // the correction does not allocate per k-mer.
+      struct workspace
+      {
+        workspace(const pop_strat_corrector& corrector)
+          : features(corrector.m_alt_global_features),
+            fitter(corrector.m_null_global_features, corrector.m_Y)
+        {}
+
+        dense_matrix features;
+        glm_workspace glm;
+        batch_irls fitter;
+        dense_matrix cols;
+        dense_matrix screened;
+        std::vector<glm_fit_t> models;
+        vector_t log_likelihoods;
+        std::vector<std::size_t> to_fit;
+        vector_t v;
+
+        pval_cache cache;
+        std::vector<pval_cache::key_t> keys;
+        std::vector<std::size_t> misses;
+        std::vector<std::pair<std::size_t, std::size_t>> copies;
+        std::vector<std::size_t> pending;
+        std::size_t hits {0};
+        std::size_t lookups {0};
+      };
+
+      // Corrects n k-mers. Count vectors already seen by this thread, or earlier in the same
+      // call, take their p-value from the cache and only the others are fitted.
+      template<std::size_t KSIZE>
+      void correct(KmerSign<KSIZE>* kmers, std::size_t n, workspace& ws)
+      {
+        ws.keys.resize(n);
+        ws.misses.clear();
+        ws.copies.clear();
+        ws.pending.clear();
 
-        for (std::size_t f = 0; f < nrows(m_null_global_features); f++)
+        for (std::size_t k = 0; k < n; k++)
         {
-          vector_t data(ncols(m_null_global_features));
+          ws.keys[k] = pval_cache::key(kmers[k].m_counts);
 
-          for (std::size_t i = 0; i < ncols(m_null_global_features); i++)
+          double pval;
+          if (ws.cache.find(ws.keys[k], pval))
           {
-            data[i] = m_null_global_features[f][i];
+            kmers[k].set_pval(pval);
+            continue;
           }
 
-          double p = predict(m_null_model, data);
+          ws.pending.push_back(k);
+        }
 
-          if (m_Y[f] == 1)
-          {
-            null_likelihood *= p;
-          }
+        // Sorted by key, the misses that share their count vector are adjacent and only the
+        // first one is fitted.
+        std::sort(ws.pending.begin(), ws.pending.end(), [&ws](std::size_t a, std::size_t b) {
+          return ws.keys[a] != ws.keys[b] ? ws.keys[a] < ws.keys[b] : a < b;
+        });
+
+        for (std::size_t i = 0; i < ws.pending.size(); i++)
+        {
+          std::size_t k = ws.pending[i];
+          if (i > 0 && ws.keys[ws.pending[i - 1]] == ws.keys[k])
+            ws.copies.emplace_back(k, ws.misses.back());
           else
+            ws.misses.push_back(k);
+        }
+
+      #ifdef KMD_USE_IRLS
+        for (std::size_t b = 0; b < ws.misses.size(); b += s_batch_size)
+          this->apply(kmers, ws.misses.data() + b, std::min(s_batch_size, ws.misses.size() - b), ws);
+      #else
+        for (auto k : ws.misses)
+          this->apply(kmers[k], ws);
+      #endif
+
+        for (auto k : ws.misses)
+          ws.cache.insert(ws.keys[k], kmers[k].m_pvalue);
+
+        for (auto& [k, src] : ws.copies)
+          kmers[k].set_pval(kmers[src].m_pvalue);
+
+        ws.lookups += n;
+        ws.hits += n - ws.misses.size();
+      }
+
+    private:
+      void standardize();
+
+      template<std::size_t KSIZE>
+      void apply(KmerSign<KSIZE>& ks, workspace& ws)
+      {
+        dense_matrix& local_features = ws.features;
+        const std::size_t last = m_alt_feature_count - 1;
+
+        for (std::size_t i = 0; i < m_size; i++)
+        {
+          local_features[i][last] = 0;
+        }
+
+        const auto& index = ks.m_counts.index();
+        const auto& value = ks.m_counts.value();
+        for (std::size_t k = 0; k < index.size(); k++)
+        {
+          local_features[index[k]][last] = static_cast<double>(value[k]) / m_totals[index[k]];
+        }
+
+        if (s_test == PopTest::SCORE)
+        {
+          ws.cols.assign(1, m_size);
+          for (std::size_t i = 0; i < m_size; i++)
+            ws.cols[0][i] = local_features[i][last];
+
+          double pval = score_pvalue(ws.cols[0], ws.v);
+          if (!s_refit || pval > s_screen)
           {
-            null_likelihood *= 1.0 - p;
+            ks.set_pval(pval);
+            return;
           }
         }
 
-        if (null_likelihood == 0.0 && alt_likelihood == 0.0)
+        #ifdef KMD_USE_IRLS
+          const auto& [model, singular, nan, error, iter] = glm_irls(
+            local_features, m_Y, s_max_iter, ws.glm, m_alt_start);
+        #else
+          const auto& [model, singular, nan, error, iter] = glm_newton_raphson(
+            local_features, m_Y, s_learn_rate, s_max_iter, ws.glm);
+        #endif
+
+        ks.set_pval(lrt_pvalue(log_likelihood(model, local_features, m_Y)));
+      }
+
+      // Fits the alt models of the k-mers kmers[idx[0..n)] at once, the null features are the
+      // shared columns of their designs.
+      template<std::size_t KSIZE>
+      void apply(KmerSign<KSIZE>* kmers, const std::size_t* idx, std::size_t n, workspace& ws)
+      {
+        dense_matrix* cols = &ws.cols;
+        cols->assign(n, m_size);
+        ws.to_fit.clear();
+
+        for (std::size_t k = 0; k < n; k++)
         {
-          null_likelihood = 0.001;
-          alt_likelihood = 1.0;
+          const auto& counts = kmers[idx[k]].m_counts;
+          std::fill((*cols)[k], (*cols)[k] + m_size, 0.0);
+          for (std::size_t j = 0; j < counts.nnz(); j++)
+            (*cols)[k][counts.index()[j]] = static_cast<double>(counts.value()[j]) / m_totals[counts.index()[j]];
         }
 
-        double likelihood_ratio = null_likelihood / alt_likelihood;
-        double log_likelihood_ratio = -2.0 * (log(likelihood_ratio));
+        if (s_test == PopTest::SCORE)
+        {
+          for (std::size_t k = 0; k < n; k++)
+          {
+            double pval = score_pvalue((*cols)[k], ws.v);
+            if (s_refit && pval <= s_screen)
+              ws.to_fit.push_back(k);
+            else
+              kmers[idx[k]].set_pval(pval);
+          }
+
+          if (ws.to_fit.empty())
+            return;
 
-        if (std::fabs(log_likelihood_ratio) < s_epsilon ||
-            log_likelihood_ratio < 0.0 ||
-            std::isnan(alt_likelihood))
+          ws.screened.assign(ws.to_fit.size(), m_size);
+          for (std::size_t k = 0; k < ws.to_fit.size(); k++)
+            std::copy((*cols)[ws.to_fit[k]], (*cols)[ws.to_fit[k]] + m_size, ws.screened[k]);
+          cols = &ws.screened;
+        }
+        else
         {
-          log_likelihood_ratio = 0.0;
+          for (std::size_t k = 0; k < n; k++)
+            ws.to_fit.push_back(k);
         }
 
-        auto corrected = alglib::chisquarecdistribution(1, log_likelihood_ratio);
+        ws.fitter.fit(*cols, s_max_iter, ws.models, m_alt_start);
+        ws.fitter.log_likelihoods(ws.models, ws.log_likelihoods);
 
-        //spdlog::debug("{} {} {} {}", ks.to_string(), ks.m_pvalue, corrected, significance_to_char(ks.m_sign));
-
-        ks.set_pval(corrected);
+        for (std::size_t k = 0; k < ws.to_fit.size(); k++)
+          kmers[idx[ws.to_fit[k]]].set_pval(lrt_pvalue(ws.log_likelihoods[k]));
       }
 
+      double lrt_pvalue(double alt_log_likelihood) const;
+      double score_pvalue(const double* col, vector_t& v) const;
+
     private:
       matrix_t m_Z;
       matrix_t m_C;
@@ -348,6 +749,9 @@ namespace kmdiff {
       std::size_t m_cov_count {0};
 
       vector_t m_null_model;
+      double m_null_log_likelihood {0.0};
+      vector_t m_alt_start;
+      score_test m_score;
 
       vector_ull_t m_totals;
       vector_ull_t m_control_totals;
@@ -356,8 +760,8 @@ namespace kmdiff {
       vector_ull_t m_control_idx;
       vector_ull_t m_case_idx;
 
-      matrix_t m_null_global_features;
-      matrix_t m_alt_global_features;
+      dense_matrix m_null_global_features;
+      dense_matrix m_alt_global_features;
 
       std::vector<int> m_ginfo;
 
@@ -1,7 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
+#include <fmt/format.h>
+
+#include <kmdiff/exceptions.hpp>
+
 namespace kmdiff {
 
   template <typename T>
@@ -34,5 +41,124 @@ namespace kmdiff {
     const T& operator[](size_t index) const { return m_data[m_start + index];}
   };
 
+  /*
+    Nonzero entries of a count vector by increasing index, with the sums of the controls and the
+    cases. In wide cohorts most k-mers are present in a few samples, so that what consumes this
+    view scales with the number of samples where a k-mer is present, and the dense vector is only
+    materialized on request.
+  */
+  template <typename T>
+  class SparseCounts
+  {
+    // Counts are only widened, a narrower T would silently truncate them.
+    template <typename U>
+    static constexpr bool fits = std::numeric_limits<U>::max() <= std::numeric_limits<T>::max();
+
+   public:
+    SparseCounts() = default;
+
+    template <typename U>
+    SparseCounts(const SparseCounts<U>& other)
+      : m_index(other.index()),
+        m_value(other.value().begin(), other.value().end()),
+        m_size(other.size()),
+        m_sum_controls(other.sum_controls()),
+        m_sum_cases(other.sum_cases()),
+        m_positive_controls(other.positive_controls()),
+        m_positive_cases(other.positive_cases())
+    {
+      static_assert(fits<U>, "SparseCounts: narrowing conversion of the counts.");
+    }
+
+    // The first nb_controls entries of dense are the controls.
+    template <typename U>
+    void assign(const std::vector<U>& dense, std::size_t nb_controls)
+    {
+      static_assert(fits<U>, "SparseCounts: narrowing conversion of the counts.");
+
+      m_index.clear();
+      m_value.clear();
+      m_size = dense.size();
+      m_sum_controls = m_sum_cases = 0;
+      m_positive_controls = m_positive_cases = 0;
+
+      for (std::size_t i = 0; i < dense.size(); i++)
+      {
+        if (!dense[i])
+          continue;
+
+        m_index.push_back(i);
+        m_value.push_back(dense[i]);
+
+        if (i < nb_controls)
+        {
+          m_sum_controls += dense[i];
+          m_positive_controls++;
+        }
+        else
+        {
+          m_sum_cases += dense[i];
+          m_positive_cases++;
+        }
+      }
+    }
+
+    template <typename U>
+    void dense(U* out) const
+    {
+      std::fill(out, out + m_size, U{0});
+      for (std::size_t k = 0; k < m_index.size(); k++)
+        out[m_index[k]] = m_value[k];
+    }
+
+    std::size_t size() const { return m_size; }
+    std::size_t nnz() const { return m_index.size(); }
+
+    const std::vector<std::uint32_t>& index() const { return m_index; }
+    const std::vector<T>& value() const { return m_value; }
+
+    double sum_controls() const { return m_sum_controls; }
+    double sum_cases() const { return m_sum_cases; }
+    std::size_t positive_controls() const { return m_positive_controls; }
+    std::size_t positive_cases() const { return m_positive_cases; }
+
+    template <typename Stream>
+    void dump(Stream& stream) const
+    {
+      std::uint32_t size = m_size;
+      std::uint32_t nnz = m_index.size();
+      stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+      stream.write(reinterpret_cast<const char*>(&nnz), sizeof(nnz));
+      stream.write(reinterpret_cast<const char*>(m_index.data()), nnz * sizeof(std::uint32_t));
+      stream.write(reinterpret_cast<const char*>(m_value.data()), nnz * sizeof(T));
+    }
+
+    // The sums are not stored, they are only needed by the models. A record with more nonzero
+    // counts than entries is corrupt, it is rejected before anything is allocated.
+    template <typename Stream>
+    void load(Stream& stream)
+    {
+      std::uint32_t size = 0, nnz = 0;
+      stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+      stream.read(reinterpret_cast<char*>(&nnz), sizeof(nnz));
+      if (nnz > size)
+        throw IOError(fmt::format("Corrupt count vector: {} nonzero counts for {} samples.", nnz, size));
+      m_size = size;
+      m_index.resize(nnz);
+      m_value.resize(nnz);
+      stream.read(reinterpret_cast<char*>(m_index.data()), nnz * sizeof(std::uint32_t));
+      stream.read(reinterpret_cast<char*>(m_value.data()), nnz * sizeof(T));
+    }
+
+   private:
+    std::vector<std::uint32_t> m_index;
+    std::vector<T> m_value;
+    std::size_t m_size {0};
+    double m_sum_controls {0};
+    double m_sum_cases {0};
+    std::size_t m_positive_controls {0};
+    std::size_t m_positive_cases {0};
+  };
+
 } // end of namespace kmdiff
 
@@ -0,0 +1,77 @@
+/*****************************************************************************
+ *   kmdiff
+ *   Authors: T. Lemane
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+#pragma once
+
+// std
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ext
+#include <fmt/format.h>
+
+// int
+#include <kmdiff/exceptions.hpp>
+
+namespace fs = std::filesystem;
+
+namespace kmdiff {
+
+  /*
+    A shard is a diff restricted to a range of partitions, so that one analysis can be split
+    across processes or nodes sharing the output directory. Each shard writes a descriptor in
+    <output>/shards, and kmdiff diff-merge checks them and aggregates their partitions with the
+    global number of tested k-mers.
+  */
+  struct shard_info
+  {
+    std::size_t first {0};
+    std::size_t last {0};
+    std::size_t nb_partitions {0};
+    std::size_t kmer_size {0};
+    std::string stage;
+    std::string key;
+    double threshold {0};
+    double cutoff {0};
+    bool sorted {false};
+    double level {0};
+    std::size_t total_kmers {0};
+
+    std::string name() const { return fmt::format("{}-{}", first, last - 1); }
+
+    void write(const std::string& path) const;
+    static shard_info read(const std::string& path);
+  };
+
+  // [first, last) of a --partitions range "a-b", bounds included.
+  std::pair<std::size_t, std::size_t> parse_partitions(const std::string& range,
+                                                       std::size_t nb_partitions);
+
+  // [first, last) of the i-th of n equal ranges, for a --shard "i/n".
+  std::pair<std::size_t, std::size_t> parse_shard(const std::string& shard,
+                                                  std::size_t nb_partitions);
+
+  std::string shard_dir(const std::string& output_dir);
+
+  // Descriptors of an output directory, sorted by range. They must come from the same analysis
+  // and cover each partition once.
+  std::vector<shard_info> load_shards(const std::string& output_dir);
+
+} // end of namespace kmdiff
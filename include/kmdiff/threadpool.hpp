@@ -19,10 +19,15 @@
 #pragma once
 
 // std
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <functional>
-#include <future>
 #include <iostream>
-#include <queue>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <thread>
@@ -30,12 +35,63 @@
 
 namespace kmdiff {
 
+  enum class TaskPriority
+  {
+    LOW,
+    NORMAL,
+    HIGH
+  };
+
+  /*
+    Work-stealing pool. Each worker owns one deque per priority level, pops its own tasks from
+    the back and steals from the front of the other workers' deques, higher priorities first.
+    Tasks submitted from a worker (nested tasks) go to its own deques, external submissions are
+    dispatched round-robin.
+  */
   class ThreadPool
   {
     using size_type = std::result_of<decltype (&std::thread::hardware_concurrency)()>::type;
 
+    class task_t
+    {
+      struct base
+      {
+        virtual ~base() {}
+        virtual void run(int thread_id) = 0;
+      };
+
+      template <typename Callable>
+      struct impl : base
+      {
+        impl(Callable&& f) : m_f(std::forward<Callable>(f)) {}
+        void run(int thread_id) override { m_f(thread_id); }
+        std::decay_t<Callable> m_f;
+      };
+
+     public:
+      task_t() = default;
+
+      template <typename Callable>
+      task_t(Callable&& f) : m_impl(std::make_unique<impl<Callable>>(std::forward<Callable>(f)))
+      {}
+
+      void operator()(int thread_id) { m_impl->run(thread_id); }
+
+     private:
+      std::unique_ptr<base> m_impl {nullptr};
+    };
+
+    static constexpr std::size_t s_levels = 3;
+
+    struct worker_queue
+    {
+      std::mutex mutex;
+      std::array<std::deque<task_t>, s_levels> tasks;
+    };
+
    public:
-    ThreadPool(size_type threads);
+    // With pin, worker i is pinned to the i-th cpu of the process affinity mask (linux only).
+    ThreadPool(size_type threads, bool pin = false);
 
     ThreadPool() = delete;
     ThreadPool(const ThreadPool&) = delete;
@@ -45,33 +101,61 @@ namespace kmdiff {
 
     ~ThreadPool();
 
+    // Waits for all tasks, including nested ones, then stops the workers.
     void join_all();
 
     void join(int i);
 
+    size_type size() const { return _n; }
+
     template <typename Callable>
-    void add_task(Callable&& f)
+    void add_task(Callable&& f, TaskPriority priority = TaskPriority::NORMAL)
     {
-      auto task = std::make_shared<std::packaged_task<void(int)>>(std::forward<Callable>(f));
+      if (_stop && !is_worker()) throw std::runtime_error("Push on stopped Pool.");
+
+      std::size_t w = is_worker() ? s_worker_id : _next++ % _n;
+      _pending++;
+      _queued++;
+      {
+        std::unique_lock<std::mutex> lock(_queues[w]->mutex);
+        _queues[w]->tasks[static_cast<std::size_t>(priority)].emplace_back(
+          std::forward<Callable>(f));
+      }
       {
-        std::unique_lock<std::mutex> lock(_queue_mutex);
-        if (_stop) throw std::runtime_error("Push on stopped Pool.");
-        _queue.emplace([task](int thread_id) { (*task)(thread_id); });
+        std::unique_lock<std::mutex> lock(_mutex);
       }
       _condition.notify_one();
     }
 
+    // Runs pending tasks on the calling thread until done() is true, allows a task to wait
+    // for its nested tasks without blocking a worker.
+    void wait_until(const std::function<bool()>& done);
+
    private:
     void worker(int i);
+    bool is_worker() const { return s_pool == this; }
+    bool pop(std::size_t i, task_t& task);
+    bool steal(std::size_t i, task_t& task);
+    void run(task_t& task, int i);
 
    private:
     size_type _n{std::thread::hardware_concurrency()};
     std::vector<std::thread> _pool;
-    std::queue<std::function<void(int)>> _queue;
-    std::mutex _queue_mutex;
+    std::vector<std::unique_ptr<worker_queue>> _queues;
+
+    std::atomic<std::size_t> _next{0};
+    std::atomic<std::size_t> _pending{0};
+    std::atomic<std::size_t> _queued{0};
+
+    std::mutex _mutex;
     std::condition_variable _condition;
-    bool _stop{false};
+    std::atomic<bool> _stop{false};
+
+    std::mutex _ep_mutex;
+    std::exception_ptr _ep{nullptr};
+
+    inline static thread_local ThreadPool* s_pool = nullptr;
+    inline static thread_local std::size_t s_worker_id = 0;
   };
 
 } // end of namespace kmdiff
-
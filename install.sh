@@ -13,7 +13,7 @@ function kmdiff_build ()
   if [ "$(uname)" != "Darwin" ]; then
     cmake .. -DCMAKE_BUILD_TYPE=${1} -DKMER_LIST="${2}" -DMAX_C=${3} -DWITH_POPSTRAT=${4} -DWITH_TESTS=${5}
   else
-    cmake .. -DCMAKE_PREFIX_PATH="/usr/local/opt/openblas;/usr/local/opt/lapack" -DCMAKE_BUILD_TYPE=${1} -DKMER_LIST="${2}" -DMAX_C=${3} -DWITH_POPSTRAT=${4} -DWITH_TESTS=${5} -DWITH_PLUGIN=${9}
+    cmake .. -DCMAKE_BUILD_TYPE=${1} -DKMER_LIST="${2}" -DMAX_C=${3} -DWITH_POPSTRAT=${4} -DWITH_TESTS=${5} -DWITH_PLUGIN=${9}
   fi
 
   make -j${6}
@@ -35,12 +35,7 @@ function kmdiff_build_conda ()
     conda install -y -c conda-forge clangxx_osx-64=11.1.0 \
                                     cmake \
                                     zlib \
-                                    bzip2 \
-                                    openblas \
-                                    openblas-devel \
-                                    liblapacke \
-                                    liblapack \
-                                    gsl
+                                    bzip2
 
     export CC=$(realpath ./kmdiff_conda/bin/x86_64-apple-darwin13.4.0-clang)
     export CXX=$(realpath ./kmdiff_conda/bin/x86_64-apple-darwin13.4.0-clang++)
@@ -48,12 +43,7 @@ function kmdiff_build_conda ()
     conda install -y -c conda-forge gxx_linux-64=9.3.0 \
                                     cmake \
                                     zlib \
-                                    bzip2 \
-                                    openblas \
-                                    openblas-devel \
-                                    liblapacke \
-                                    liblapack \
-                                    gsl
+                                    bzip2
 
     export CC=$(realpath ./kmdiff_conda/bin/x86_64-conda_cos6-linux-gnu-gcc)
     export CXX=$(realpath ./kmdiff_conda/bin/x86_64-conda_cos6-linux-gnu-g++)
@@ -86,7 +76,6 @@ function usage ()
   echo "  -c <1|2|4>         -> byte per count {4}."
   echo "  -j <INT>           -> nb threads {8}."
   echo "  -s <0|1>           -> population stratification correction 0 = disabled, 1 = enabled {1}"
-  echo "                        (-s 1 requires GSL + lapacke + OpenBLAS)"
   echo "  -p                 -> compile with plugins support {disabled}"
   echo "  -e                 -> use conda to install compilers/dependencies {disabled}"
   echo "  -d                 -> delete cmake cache {disabled}"
@@ -1,5 +1,10 @@
+#include <algorithm>
 #include <string>
 #include <filesystem>
+#include <memory>
+#include <numeric>
+#include <sstream>
+
 #include <kmdiff/accumulator.hpp>
 
 namespace fs = std::filesystem;
@@ -16,4 +21,128 @@ namespace kmdiff {
     return true;
   }
 
+  std::vector<std::string> partition_paths(const std::string& prefix, size_t nb_partitions, const std::string& dir)
+  {
+    std::vector<std::string> paths;
+    for (std::size_t i = 0; i < nb_partitions; ++i)
+      paths.push_back(fmt::format(prefix, dir, i));
+    return paths;
+  }
+
+  std::uint64_t file_checksum(const std::string& path)
+  {
+    std::ifstream in(path, std::ios::in | std::ios::binary); check_fstream_good(path, in);
+    std::vector<char> buffer(1 << 20);
+    std::unique_ptr<XXH64_state_t, decltype(&XXH64_freeState)> state(XXH64_createState(),
+                                                                     XXH64_freeState);
+    XXH64_reset(state.get(), 0);
+
+    while (in)
+    {
+      in.read(buffer.data(), buffer.size());
+      if (in.gcount())
+        XXH64_update(state.get(), buffer.data(), in.gcount());
+    }
+    return XXH64_digest(state.get());
+  }
+
+  static std::int64_t file_mtime(const std::string& path)
+  {
+    return fs::last_write_time(path).time_since_epoch().count();
+  }
+
+  partition_manifest::partition_manifest(const std::string& path,
+                                         const std::string& key,
+                                         const std::vector<std::string>& partitions)
+    : m_path(path), m_key(key), m_partitions(partitions),
+      m_entries(partitions.size()), m_done(partitions.size(), 0)
+  {
+    std::ifstream in(m_path, std::ios::in);
+    std::string line;
+
+    if (!std::getline(in, line) || line != header())
+    {
+      in.close();
+      reset();
+      return;
+    }
+
+    // A line cut by a kill either does not parse or has a wrong checksum.
+    while (std::getline(in, line))
+    {
+      std::istringstream ss(line);
+      std::size_t p = 0;
+      entry e;
+      if (!(ss >> p >> e.kmers >> e.total >> e.controls >> e.cases >> std::hex >> e.checksum
+               >> std::dec >> e.size >> e.mtime >> e.level >> e.sorted))
+        continue;
+      if (p < m_entries.size())
+        m_entries[p] = e;
+    }
+    in.close();
+
+    // An unchanged mtime is trusted, the file is only read when it was touched or copied.
+    for (std::size_t p = 0; p < m_entries.size(); p++)
+    {
+      const std::string& path = m_partitions[p];
+      m_done[p] = m_entries[p] && fs::exists(path) &&
+                  fs::file_size(path) == m_entries[p]->size &&
+                  (file_mtime(path) == m_entries[p]->mtime ||
+                   file_checksum(path) == m_entries[p]->checksum);
+    }
+
+    m_out.open(m_path, std::ios::out | std::ios::app); check_fstream_good(m_path, m_out);
+  }
+
+  void partition_manifest::reset()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    std::fill(m_entries.begin(), m_entries.end(), std::nullopt);
+    std::fill(m_done.begin(), m_done.end(), 0);
+
+    if (m_out.is_open())
+      m_out.close();
+
+    m_out.open(m_path, std::ios::out | std::ios::trunc); check_fstream_good(m_path, m_out);
+    m_out << header() << std::endl;
+  }
+
+  bool partition_manifest::complete(std::size_t first, std::size_t last) const
+  {
+    return std::all_of(m_done.begin() + first, m_done.begin() + last, [](std::uint8_t d) { return d; });
+  }
+
+  std::size_t partition_manifest::total() const
+  {
+    return std::accumulate(m_entries.begin(), m_entries.end(), 0ULL,
+      [](std::size_t acc, const std::optional<entry>& e) { return e ? acc + e->total : acc; });
+  }
+
+  void partition_manifest::keep_if(const std::function<bool(const entry&)>& pred)
+  {
+    for (std::size_t p = 0; p < m_entries.size(); p++)
+      m_done[p] = m_done[p] && pred(*m_entries[p]);
+  }
+
+  void partition_manifest::commit(std::size_t p, entry e)
+  {
+    if (!e.checksum)
+      e.checksum = file_checksum(m_partitions[p]);
+    e.size = fs::file_size(m_partitions[p]);
+    e.mtime = file_mtime(m_partitions[p]);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_out << fmt::format("{} {} {} {} {} {:016x} {} {} {} {:d}",
+                         p, e.kmers, e.total, e.controls, e.cases, e.checksum, e.size, e.mtime,
+                         e.level, e.sorted) << std::endl;
+    m_entries[p] = e;
+    m_done[p] = 1;
+  }
+
+  std::string partition_manifest::header() const
+  {
+    return fmt::format("kmdiff-manifest v{} {}", s_version, m_key);
+  }
+
 } // end of namespace kmdiff
@@ -0,0 +1,184 @@
+/*****************************************************************************
+ *   kmdiff
+ *   Authors: T. Lemane
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+#include <cstring>
+
+#include <zlib.h>
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#include <kmdiff/bgzf.hpp>
+#include <kmdiff/exceptions.hpp>
+
+namespace kmdiff {
+
+  namespace {
+
+    constexpr std::size_t header_size = 18;
+    constexpr std::size_t footer_size = 8;
+
+    // empty BGZF block, marks the end of file
+    constexpr uint8_t bgzf_eof[28] = {
+      0x1f, 0x8b, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x00, 0x42, 0x43,
+      0x02, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+
+    inline void put16(uint8_t* p, uint16_t v)
+    {
+      p[0] = v & 0xff; p[1] = v >> 8;
+    }
+
+    inline void put32(uint8_t* p, uint32_t v)
+    {
+      p[0] = v & 0xff; p[1] = (v >> 8) & 0xff; p[2] = (v >> 16) & 0xff; p[3] = v >> 24;
+    }
+
+  } // end of anonymous namespace
+
+  BgzfWriter::BgzfWriter(const std::string& path, std::size_t nb_threads, int level)
+    : m_path(path), m_level(level)
+  {
+    m_out = std::fopen(m_path.c_str(), "wb");
+    if (!m_out)
+      throw IOError(fmt::format("Unable to write at {}.", m_path));
+
+    if (nb_threads < 1) nb_threads = 1;
+    m_max_inflight = nb_threads * 4;
+    m_pool = std::make_unique<ThreadPool>(nb_threads);
+    m_buffer.reserve(block_size);
+  }
+
+  BgzfWriter::~BgzfWriter()
+  {
+    if (!m_out)
+      return;
+
+    // Not closed: the file is left without its EOF marker, so that it reads as truncated.
+    try
+    {
+      m_pool->join_all();
+    }
+    catch (const std::exception& e)
+    {
+      spdlog::error("bgzf: {}", e.what());
+    }
+    std::fclose(m_out);
+    spdlog::warn("{} was not closed, it is incomplete.", m_path);
+  }
+
+  void BgzfWriter::write(const char* data, std::size_t size)
+  {
+    while (size > 0)
+    {
+      std::size_t n = std::min(size, block_size - m_buffer.size());
+      m_buffer.insert(m_buffer.end(), data, data + n);
+      data += n; size -= n;
+
+      if (m_buffer.size() == block_size)
+        submit();
+    }
+  }
+
+  void BgzfWriter::close()
+  {
+    if (!m_buffer.empty())
+      submit();
+
+    while (!m_inflight.empty())
+      write_front();
+
+    m_pool->join_all();
+
+    bool eof = std::fwrite(bgzf_eof, 1, sizeof(bgzf_eof), m_out) == sizeof(bgzf_eof);
+    bool closed = std::fclose(m_out) == 0;
+    m_out = nullptr;
+
+    if (!eof || !closed)
+      throw IOError(fmt::format("Unable to write at {}.", m_path));
+  }
+
+  void BgzfWriter::submit()
+  {
+    if (m_inflight.size() >= m_max_inflight)
+      write_front();
+
+    auto block = std::make_shared<block_t>();
+    block->swap(m_buffer);
+    m_buffer.reserve(block_size);
+
+    auto promise = std::make_shared<std::promise<block_t>>();
+    m_inflight.push_back(promise->get_future());
+
+    int level = m_level;
+    m_pool->add_task([block, promise, level](int id) {
+      try { promise->set_value(compress(*block, level)); }
+      catch (...) { promise->set_exception(std::current_exception()); }
+    });
+  }
+
+  void BgzfWriter::write_front()
+  {
+    block_t block = m_inflight.front().get();
+    m_inflight.pop_front();
+
+    if (std::fwrite(block.data(), 1, block.size(), m_out) != block.size())
+      throw IOError(fmt::format("Unable to write at {}.", m_path));
+  }
+
+  BgzfWriter::block_t BgzfWriter::compress(const block_t& in, int level)
+  {
+    block_t out(header_size + compressBound(in.size()) + footer_size);
+
+    z_stream zs;
+    std::memset(&zs, 0, sizeof(zs));
+
+    if (deflateInit2(&zs, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+      throw IOError("bgzf: deflateInit2 failed.");
+
+    zs.next_in = const_cast<Bytef*>(in.data());
+    zs.avail_in = in.size();
+    zs.next_out = out.data() + header_size;
+    zs.avail_out = out.size() - header_size - footer_size;
+
+    int ret = deflate(&zs, Z_FINISH);
+    std::size_t csize = zs.total_out;
+    deflateEnd(&zs);
+
+    if (ret != Z_STREAM_END)
+      throw IOError("bgzf: deflate failed.");
+
+    std::size_t bsize = header_size + csize + footer_size;
+    out.resize(bsize);
+
+    uint8_t* h = out.data();
+    h[0] = 0x1f; h[1] = 0x8b; h[2] = 0x08; h[3] = 0x04;
+    put32(h + 4, 0);
+    h[8] = 0x00; h[9] = 0xff;
+    put16(h + 10, 6);
+    h[12] = 'B'; h[13] = 'C';
+    put16(h + 14, 2);
+    put16(h + 16, static_cast<uint16_t>(bsize - 1));
+
+    uint8_t* f = out.data() + header_size + csize;
+    put32(f, crc32(crc32(0L, Z_NULL, 0), in.data(), in.size()));
+    put32(f + 4, static_cast<uint32_t>(in.size()));
+
+    return out;
+  }
+
+} // end of namespace kmdiff
@@ -29,9 +29,11 @@ namespace kmdiff {
     cli = std::make_shared<bc::Parser<1>>(bc::Parser<1>(name, desc, version, authors));
     diff_opt = std::make_shared<struct diff_options>(diff_options{});
     count_opt = std::make_shared<struct count_options>(count_options{});
+    diff_merge_opt = std::make_shared<struct diff_options>(diff_options{});
     info_cli(cli);
     count_cli(cli, count_opt);
     diff_cli(cli, diff_opt);
+    diff_merge_cli(cli, diff_merge_opt);
   }
 
   std::tuple<COMMAND, kmdiff_options_t> kmdiffCli::parse(int argc, char* argv[])
@@ -60,6 +62,8 @@ namespace kmdiff {
 
     if (cli->is("diff"))
       return std::make_tuple(COMMAND::DIFF, diff_opt);
+    if (cli->is("diff-merge"))
+      return std::make_tuple(COMMAND::DIFF_MERGE, diff_merge_opt);
     if (cli->is("count"))
       return std::make_tuple(COMMAND::COUNT, count_opt);
     else
@@ -145,22 +149,46 @@ namespace kmdiff {
     return options;
   }
 
+  static std::function<void(const std::string&)> correction_setter(diff_options_t options)
+  {
+    return [options](const std::string& v) {
+      if (v == "bonferroni")
+        options->correction = CorrectionType::BONFERRONI;
+      else if (v == "benjamini")
+        options->correction = CorrectionType::BENJAMINI;
+      else if (v == "sidak")
+        options->correction = CorrectionType::SIDAK;
+      else if (v == "holm")
+        options->correction = CorrectionType::HOLM;
+      else
+        options->correction = CorrectionType::NOTHING;
+    };
+  }
+
   kmdiff_options_t diff_cli(std::shared_ptr<bc::Parser<1>> cli, diff_options_t options)
   {
     bc::cmd_t diff_cmd = cli->add_command("diff", "Differential k-mers analysis.");
 
     auto is_kmtricks_dir = [](const std::string& p,
                               const std::string& v) -> bc::check::checker_ret_t {
-      return std::make_tuple(
-          fs::exists(fmt::format("{}/kmtricks.fof", v)),
-          fmt::format("{} {} : Not a kmtricks runtime directory.", p, v));
+      for (auto& d : bc::utils::split(v, ','))
+      {
+        if (!fs::exists(fmt::format("{}/kmtricks.fof", d)))
+          return std::make_tuple(false, fmt::format("{} {} : Not a kmtricks runtime directory.", p, d));
+      }
+      return std::make_tuple(true, "");
+    };
+
+    auto km_run_setter = [options](const std::string& v) {
+      options->kmtricks_dirs = bc::utils::split(v, ',');
+      options->kmtricks_dir = options->kmtricks_dirs.front();
     };
 
-    diff_cmd->add_param("-d/--km-run", "kmtricks run directory.")
+    diff_cmd->add_param("-d/--km-run", "kmtricks run directory, or compatible ones, comma-separated, whose\n" \
+               "                        samples are analysed together in this order.")
         ->meta("DIR")
-        ->checker(bc::check::is_dir)
         ->checker(is_kmtricks_dir)
-        ->setter(options->kmtricks_dir);
+        ->setter_c(km_run_setter);
 
     diff_cmd->add_param("-o/--output-dir", "output directory.")
         ->meta("DIR")
@@ -203,18 +231,14 @@ namespace kmdiff {
       ->setter(options->cutoff)
       ->def("100000");
 
-    auto corr_setter = [options](const std::string& v) {
-      if (v == "bonferroni")
-        options->correction = CorrectionType::BONFERRONI;
-      else if (v == "benjamini")
-        options->correction = CorrectionType::BENJAMINI;
-      else if (v == "sidak")
-        options->correction = CorrectionType::SIDAK;
-      else if (v == "holm")
-        options->correction = CorrectionType::HOLM;
-      else
-        options->correction = CorrectionType::NOTHING;
-    };
+    diff_cmd->add_param("--retain", "retain k-mers up to this p-value, sorted, so that later runs with a lower\n" \
+               "                        significance/cutoff reuse the merge instead of redoing it. (0: disabled)")
+      ->meta("FLOAT")
+      ->checker(sign_check)
+      ->setter(options->retain)
+      ->def("0");
+
+    auto corr_setter = correction_setter(options);
 
     bc::param_t cp = diff_cmd->add_param("-c/--correction",
                                          "significance correction. (bonferroni|benjamini|sidak|holm|disabled)")
@@ -234,6 +258,14 @@ namespace kmdiff {
         ->as_flag()
         ->setter(options->kff);
 
+    diff_cmd->add_param("--kff-data", "store p-values and means as kff data (with -f/--kff-output).")
+        ->as_flag()
+        ->setter(options->kff_data);
+
+    diff_cmd->add_param("-z/--gzip-output", "output significant k-mers in bgzf-compressed fasta.")
+        ->as_flag()
+        ->setter(options->gzip);
+
     auto memory_warn = [](){
       spdlog::warn("-m/--in-memory: all significants k-mers will live in memory.");
     };
@@ -255,6 +287,20 @@ namespace kmdiff {
         ->as_flag()
         ->setter(options->save_sk);
 
+    diff_cmd->add_param("--pin-threads", "pin merge and popstrat worker threads to the allowed cpus.")
+        ->as_flag()
+        ->setter(options->pin_threads);
+
+    diff_cmd->add_param("--partitions", "only process this range of partitions, e.g. 0-99, as a shard (see diff-merge).")
+        ->meta("STR")
+        ->def("")
+        ->setter(options->partitions);
+
+    diff_cmd->add_param("--shard", "only process the i-th of n equal ranges of partitions, e.g. 0/4 (see diff-merge).")
+        ->meta("STR")
+        ->def("")
+        ->setter(options->shard);
+
     #ifdef WITH_PLUGIN
       diff_cmd->add_group("custom model", "");
 
@@ -289,6 +335,16 @@ namespace kmdiff {
           ->checker(bc::check::f::range(0.0, 0.05))
           ->setter(options->kmer_pca);
 
+      diff_cmd->add_param("--pca-text", "write k-mers sampled for PCA as text instead of packed genotypes.")
+          ->as_flag()
+          ->setter(options->pca_text);
+
+      diff_cmd->add_param("--pcs", "precomputed principal components, one sample per line in the fof order.")
+          ->meta("FILE")
+          ->def("")
+          ->checker(bc::check::is_file)
+          ->setter(options->pcs);
+
       auto ploidy_setter = [options](const std::string& v) {
         options->ploidy = bc::utils::lexical_cast<size_t>(v);
         if (options->ploidy == 2) options->is_diploid = true;
@@ -307,6 +363,24 @@ namespace kmdiff {
           ->checker(bc::check::f::range(2, 10))
           ->setter(options->npc);
 
+      auto pop_test_setter = [options](const std::string& v) {
+        options->pop_test = v == "score" ? PopTest::SCORE : PopTest::LRT;
+      };
+
+      diff_cmd->add_param("--pop-test", "test used for the correction, score is a fast screen. (lrt|score)")
+          ->meta("STR")
+          ->def("lrt")
+          ->checker(bc::check::f::in("lrt|score"))
+          ->setter_c(pop_test_setter);
+
+      diff_cmd->add_param("--pop-refit", "refit k-mers passing the score screen with the lrt (with --pop-test score).")
+          ->as_flag()
+          ->setter(options->pop_refit);
+
+      diff_cmd->add_param("--pop-fused", "correct k-mers during the merge instead of in a separate pass.")
+          ->as_flag()
+          ->setter(options->pop_fused);
+
       diff_cmd->add_param("--covariates", "covariates file.")
           ->meta("FILE")
           ->def("")
@@ -346,7 +420,7 @@ namespace kmdiff {
         ->as_flag()
         ->setter(options->irls);
 
-    diff_cmd->add_param("--random-seed", "random seed for pca sampling (deterministic only with 1 thread).")
+    diff_cmd->add_param("--random-seed", "random seed for pca sampling.")
         ->meta("INT")
         ->def("0")
         ->setter(options->seed);
@@ -361,6 +435,43 @@ namespace kmdiff {
     return options;
   }
 
+  kmdiff_options_t diff_merge_cli(std::shared_ptr<bc::Parser<1>> cli, diff_options_t options)
+  {
+    bc::cmd_t merge_cmd = cli->add_command("diff-merge", "Aggregate the shards of a diff.");
+
+    merge_cmd->add_param("-o/--output-dir", "output directory of the shards.")
+        ->meta("DIR")
+        ->checker(bc::check::is_dir)
+        ->setter(options->output_directory)
+        ->def("./kmdiff_output");
+
+    merge_cmd->add_param("-c/--correction", "significance correction. (bonferroni|benjamini|sidak|holm|disabled)")
+        ->meta("STR")
+        ->def("bonferroni")
+        ->checker(bc::check::f::in("bonferroni|benjamini|sidak|holm|disabled"))
+        ->setter_c(correction_setter(options));
+
+    merge_cmd->add_param("-f/--kff-output", "output significant k-mers in kff format.")
+        ->as_flag()
+        ->setter(options->kff);
+
+    merge_cmd->add_param("--kff-data", "store p-values and means as kff data (with -f/--kff-output).")
+        ->as_flag()
+        ->setter(options->kff_data);
+
+    merge_cmd->add_param("-z/--gzip-output", "output significant k-mers in bgzf-compressed fasta.")
+        ->as_flag()
+        ->setter(options->gzip);
+
+    merge_cmd->add_param("--keep-tmp", "keep the partitions of the shards.")
+        ->as_flag()
+        ->setter(options->keep_tmp);
+
+    add_common(merge_cmd, options);
+
+    return options;
+  }
+
   void info_cli(std::shared_ptr<bc::Parser<1>> cli)
   {
     bc::cmd_t info_cmd = cli->add_command("infos", "Show build infos.");
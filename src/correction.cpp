@@ -28,5 +28,21 @@ namespace kmdiff {
     }
   }
 
+  std::string pop_test_str(const PopTest test)
+  {
+    switch (test)
+    {
+      case PopTest::LRT:
+        return "LRT";
+        break;
+      case PopTest::SCORE:
+        return "SCORE";
+        break;
+      default:
+        return "";
+        break;
+    }
+  }
+
 } // end of namespace kmdiff
 
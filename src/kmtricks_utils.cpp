@@ -16,7 +16,18 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  *****************************************************************************/
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+#include <xxhash.h>
+
 #include <kmdiff/kmtricks_utils.hpp>
+#include <kmdiff/threadpool.hpp>
 #include <kmdiff/utils.hpp>
 
 #define KMTRICKS_PUBLIC
@@ -69,12 +80,89 @@ namespace kmdiff {
   }
 
 
+  // Hash of the minimizer repartition, which decides the partition of each k-mer.
+  static std::uint64_t repartition_key(const std::string& run_dir)
+  {
+    std::vector<std::string> paths;
+    for (auto& entry : fs::recursive_directory_iterator(fmt::format("{}/repartition_gatb", run_dir)))
+    {
+      if (entry.is_regular_file())
+        paths.push_back(entry.path().string());
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::uint64_t h = 0;
+    for (auto& path : paths)
+    {
+      std::ifstream in(path, std::ios::in | std::ios::binary); check_fstream_good(path, in);
+      std::stringstream ss; ss << fs::relative(path, run_dir).string() << "\n" << in.rdbuf();
+      std::string content = ss.str();
+      h = XXH64(content.data(), content.size(), h);
+    }
+    return h;
+  }
+
+  kmtricks_config_t get_kmtricks_config(const std::vector<std::string>& run_dirs)
+  {
+    kmtricks_config_t config = run_manifest::get(run_dirs.front())->config();
+
+    if (run_dirs.size() == 1)
+      return config;
+
+    std::uint64_t repart = repartition_key(run_dirs.front());
+
+    for (auto& run_dir : run_dirs)
+    {
+      std::string matrices = fmt::format("{}/matrices", run_dir);
+      if (fs::exists(matrices) && !fs::is_empty(matrices))
+        throw ConfigError(fmt::format("{}: runs counted as matrices cannot be combined.", run_dir));
+
+      kmtricks_config_t c = run_manifest::get(run_dir)->config();
+      if (c.kmer_size != config.kmer_size || c.nb_partitions != config.nb_partitions)
+        throw ConfigError(fmt::format("{} ({}) and {} ({}) are not compatible.",
+                                      run_dirs.front(), config.to_string(), run_dir, c.to_string()));
+
+      if (repartition_key(run_dir) != repart)
+        throw ConfigError(fmt::format("{} and {} use different minimizer repartitions.",
+                                      run_dirs.front(), run_dir));
+    }
+    bind_run(run_dirs.front());
+
+    return config;
+  }
+
+  void bind_run(const std::string& run_dir)
+  {
+    km::KmDir::get().init(run_dir, fmt::format("{}/kmtricks.fof", run_dir));
+  }
+
   km::Fof get_fofs(const std::string& run_dir)
   {
     std::string fof_path = fmt::format("{}/kmtricks.fof", run_dir);
     return km::Fof(fof_path);
   }
 
+  // Number of k-mers of a sample of the bound run, without those below its abundance min.
+  static std::size_t sample_total(const std::string& fid, std::size_t ab_min)
+  {
+    std::string hpath = km::KmDir::get().get_hist_path(fid);
+    km::HistReader hr(hpath);
+
+    auto hist = hr.get();
+    auto info = hr.infos();
+    auto& v = hist->get_vec();
+
+    std::size_t total = info.total;
+
+    for (std::size_t j=1; j<ab_min; j++)
+    {
+      total -= (j) * v[j-1];
+    }
+
+    spdlog::debug("{}: {} k-mers", fid, total);
+    return total;
+  }
+
   std::tuple<std::vector<size_t>, std::vector<size_t>> get_total_kmer(
     const std::string& run_dir,
     size_t nb_controls,
@@ -87,67 +175,518 @@ namespace kmdiff {
 
     auto fof_it = fof.begin();
 
-    for (std::size_t i = 0; i < total_controls.size(); i++)
+    for (std::size_t i = 0; i < nb_controls + nb_cases; i++)
     {
-      std::string fid = fof.get_id(i);
-      std::string hpath = km::KmDir::get().get_hist_path(fid);
-      km::HistReader hr(hpath);
-
-      auto hist = hr.get();
-      auto info = hr.infos();
-      auto& v = hist->get_vec();
-
       std::size_t ab_min = std::get<2>(*fof_it); fof_it++;
       if (ab_min == 0)
         ab_min = abundance_min;
 
-      total_controls[i] = info.total;
+      std::size_t total = sample_total(fof.get_id(i), ab_min);
+
+      if (i < nb_controls)
+        total_controls[i] = total;
+      else
+        total_cases[i - nb_controls] = total;
+    }
+
+    return std::make_tuple(std::move(total_controls), std::move(total_cases));
+  }
+
+  std::tuple<std::vector<size_t>, std::vector<size_t>> get_total_kmer(
+    const std::vector<std::string>& run_dirs,
+    size_t nb_controls,
+    size_t nb_cases)
+  {
+    std::vector<size_t> totals;
 
-      for (std::size_t j=1; j<ab_min; j++)
+    for (auto& run_dir : run_dirs)
+    {
+      auto manifest = run_manifest::get(run_dir);
+      for (std::size_t i = 0; i < manifest->nb_samples(); i++)
       {
-        total_controls[i] -= (j) * v[j-1];
+        totals.push_back(manifest->total(i));
+        spdlog::debug("{}: {} k-mers", manifest->id(i), totals.back());
       }
+    }
+
+    if (totals.size() < nb_controls + nb_cases)
+      throw ConfigError(fmt::format("{} samples, but {} controls and {} cases.",
+                                    totals.size(), nb_controls, nb_cases));
+
+    std::vector<size_t> total_controls(totals.begin(), totals.begin() + nb_controls);
+    std::vector<size_t> total_cases(totals.begin() + nb_controls,
+                                    totals.begin() + nb_controls + nb_cases);
+
+    return std::make_tuple(std::move(total_controls), std::move(total_cases));
+  }
+
+  part_paths_t get_partition_paths(const std::string& kmdir, std::size_t nb_parts)
+  {
+    km::KmDir::get().init(kmdir, fmt::format("{}/kmtricks.fof", kmdir));
+    part_paths_t part_paths;
+    for (std::size_t i = 0; i < nb_parts; i++)
+    {
+      part_paths.push_back(km::KmDir::get().get_files_to_merge(i, true, km::KM_FILE::KMER));
+    }
+    return part_paths;
+  }
 
-      spdlog::debug("{}: {} k-mers", fid, total_controls[i]);
+  part_paths_t get_partition_paths(const std::vector<std::string>& run_dirs, std::size_t nb_parts)
+  {
+    part_paths_t part_paths(nb_parts);
+    for (auto& run_dir : run_dirs)
+    {
+      const part_paths_t& run_paths = run_manifest::get(run_dir)->partitions();
+      for (std::size_t i = 0; i < nb_parts; i++)
+        part_paths[i].insert(part_paths[i].end(), run_paths[i].begin(), run_paths[i].end());
+    }
+    return part_paths;
+  }
+
+  std::vector<std::uintmax_t> get_partition_sizes(const std::vector<std::string>& run_dirs)
+  {
+    std::vector<std::uintmax_t> sizes;
+    for (auto& run_dir : run_dirs)
+    {
+      const auto& run_sizes = run_manifest::get(run_dir)->sizes();
+      sizes.resize(run_sizes.size(), 0);
+      for (std::size_t i = 0; i < run_sizes.size(); i++)
+        sizes[i] += run_sizes[i];
     }
+    return sizes;
+  }
 
-    for (std::size_t i = nb_controls; i < nb_controls + nb_cases; i++)
+  // The non-empty lines of a file of each run, in the order of the runs.
+  static std::string concat_runs(const std::vector<std::string>& run_dirs, const std::string& name)
+  {
+    std::ostringstream out;
+    for (auto& run_dir : run_dirs)
     {
-      std::string fid = fof.get_id(i);
-      std::string hpath = km::KmDir::get().get_hist_path(fid);
-      km::HistReader hr(hpath);
+      std::string path = fmt::format("{}/{}", run_dir, name);
+      std::ifstream in(path, std::ios::in); check_fstream_good(path, in);
+      for (std::string line; std::getline(in, line);)
+      {
+        if (!bc::utils::trim(line).empty())
+          out << line << "\n";
+      }
+    }
+    return out.str();
+  }
 
-      auto hist = hr.get();
-      auto info = hr.infos();
-      auto& v = hist->get_vec();
+  // Shards of the same output read these files while others build them: a file is only replaced
+  // when it changes, through a temporary file of this process.
+  static void write_if_changed(const std::string& path, const std::string& content)
+  {
+    if (fs::exists(path))
+    {
+      std::ifstream in(path, std::ios::in); check_fstream_good(path, in);
+      std::stringstream ss; ss << in.rdbuf();
+      if (ss.str() == content)
+        return;
+    }
 
-      std::size_t ab_min = std::get<2>(*fof_it); fof_it++;
-      if (ab_min == 0)
-        ab_min = abundance_min;
+    std::string tmp = fmt::format("{}.{}.tmp", path, getpid());
+    {
+      std::ofstream out(tmp, std::ios::out); check_fstream_good(tmp, out);
+      out << content;
+      out.flush();
+      if (!out.good())
+        throw IOError(fmt::format("Unable to write {}.", tmp));
+    }
+    fs::rename(tmp, path);
+  }
+
+  std::string fof_path(const std::vector<std::string>& run_dirs, const std::string& dir)
+  {
+    if (run_dirs.size() == 1)
+      return fmt::format("{}/kmtricks.fof", run_dirs.front());
 
-      total_cases[i - nb_controls] = info.total;
+    std::set<std::string> ids;
 
-      for (std::size_t j=1; j<ab_min; j++)
+    for (auto& run_dir : run_dirs)
+    {
+      for (auto& sample : get_fofs(run_dir))
       {
-        total_cases[i - nb_controls] -= (j) * v[j-1];
+        if (!ids.insert(std::get<0>(sample)).second)
+          throw ConfigError(fmt::format("{}: sample '{}' is already in another run.",
+                                        run_dir, std::get<0>(sample)));
       }
+    }
+
+    std::string path = fmt::format("{}/kmtricks.fof", dir);
+    write_if_changed(path, concat_runs(run_dirs, "kmtricks.fof"));
+    return path;
+  }
+
+  std::string options_path(const std::vector<std::string>& run_dirs, const std::string& dir)
+  {
+    if (run_dirs.size() == 1)
+      return fmt::format("{}/options.txt", run_dirs.front());
+
+    std::string path = fmt::format("{}/options.txt", dir);
+    write_if_changed(path, concat_runs(run_dirs, "options.txt"));
+    return path;
+  }
+
+  std::uint64_t run_key(const std::vector<std::string>& run_dirs)
+  {
+    if (run_dirs.size() == 1)
+      return run_manifest::get(run_dirs.front())->key();
 
-      spdlog::debug("{}: {} k-mers", fid, total_cases[i - nb_controls]);
+    std::uint64_t h = 0;
+    for (auto& run_dir : run_dirs)
+    {
+      std::uint64_t k = run_manifest::get(run_dir)->key();
+      h = XXH64(&k, sizeof(k), h);
     }
+    return h;
+  }
 
-    return std::make_tuple(std::move(total_controls), std::move(total_cases));
+  std::uint64_t run_key(const std::string& run_dir)
+  {
+    std::vector<std::string> lines;
+
+    // kmdiff-count.opt is left out, diff writes it in the run directory from a matrix run, after
+    // the key is computed. A recount changes the count files anyway.
+    for (auto name : {"kmtricks.fof", "options.txt"})
+    {
+      std::string path = fmt::format("{}/{}", run_dir, name);
+      if (!fs::exists(path))
+        continue;
+      std::ifstream in(path, std::ios::in); check_fstream_good(path, in);
+      std::stringstream ss; ss << in.rdbuf();
+      lines.push_back(fmt::format("{}\n{}", name, ss.str()));
+    }
+
+    for (auto name : {"matrices", "histograms"})
+    {
+      std::string path = fmt::format("{}/{}", run_dir, name);
+      if (!fs::exists(path))
+        continue;
+      for (auto& entry : fs::recursive_directory_iterator(path))
+      {
+        if (!entry.is_regular_file())
+          continue;
+        lines.push_back(fmt::format("{} {} {}",
+          fs::relative(entry.path(), run_dir).string(), entry.file_size(),
+          entry.last_write_time().time_since_epoch().count()));
+      }
+    }
+
+    // Only the partition directories are stated, a file added or removed changes their time.
+    // The count files, samples times more, are checked when their partition is merged, see
+    // run_manifest::check.
+    std::string counts = fmt::format("{}/counts", run_dir);
+    if (fs::exists(counts))
+    {
+      lines.push_back(fmt::format("counts {}",
+        fs::last_write_time(counts).time_since_epoch().count()));
+      for (auto& entry : fs::directory_iterator(counts))
+      {
+        lines.push_back(fmt::format("{} {}",
+          fs::relative(entry.path(), run_dir).string(),
+          entry.last_write_time().time_since_epoch().count()));
+      }
+    }
+
+    std::sort(lines.begin(), lines.end());
+
+    std::uint64_t h = 0;
+    for (auto& line : lines)
+      h = XXH64(line.data(), line.size(), h);
+    return h;
+  }
+
+  void check_partition(const std::vector<std::string>& run_dirs, std::size_t p)
+  {
+    for (auto& run_dir : run_dirs)
+      run_manifest::get(run_dir)->check(p);
   }
 
+  template<typename T>
+  static void write_value(std::ostream& out, const T& value)
+  {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
 
-  part_paths_t get_partition_paths(const std::string& kmdir, std::size_t nb_parts)
+  template<typename T>
+  static T read_value(std::istream& in)
   {
-    km::KmDir::get().init(kmdir, fmt::format("{}/kmtricks.fof", kmdir));
-    part_paths_t part_paths;
-    for (std::size_t i = 0; i < nb_parts; i++)
+    T value {};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+  }
+
+  static void write_string(std::ostream& out, const std::string& str)
+  {
+    write_value<std::uint64_t>(out, str.size());
+    out.write(str.data(), str.size());
+  }
+
+  // A length above max, e.g. read from a corrupt file, fails the stream instead of allocating.
+  static std::uint64_t read_length(std::istream& in, std::uint64_t max)
+  {
+    std::uint64_t length = read_value<std::uint64_t>(in);
+    if (length > max)
     {
-      part_paths.push_back(km::KmDir::get().get_files_to_merge(i, true, km::KM_FILE::KMER));
+      in.setstate(std::ios::failbit);
+      return 0;
     }
-    return part_paths;
+    return length;
+  }
+
+  static std::string read_string(std::istream& in, std::uint64_t max)
+  {
+    std::string str(read_length(in, max), '\0');
+    in.read(str.data(), str.size());
+    return str;
+  }
+
+  std::shared_ptr<const run_manifest> run_manifest::get(const std::string& run_dir)
+  {
+    static std::mutex mutex;
+    static std::map<std::string, std::shared_ptr<const run_manifest>> manifests;
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    if (auto it = manifests.find(run_dir); it != manifests.end())
+      return it->second;
+
+    std::string path = fmt::format("{}/kmdiff-run.manifest", run_dir);
+    std::uint64_t key = run_key(run_dir);
+
+    auto manifest = std::make_shared<run_manifest>();
+
+    if (!manifest->load(path, key))
+    {
+      spdlog::info("Index {}...", run_dir);
+      manifest->build(run_dir);
+
+      try
+      {
+        manifest->save(path, key);
+      }
+      catch (...)
+      {
+        spdlog::warn("Unable to write {}, the run will be indexed again next time.", path);
+      }
+    }
+
+    manifest->m_key = key;
+    manifests[run_dir] = manifest;
+    return manifest;
+  }
+
+  std::size_t run_manifest::total(std::size_t i, std::size_t ab_min) const
+  {
+    const auto& totals = m_totals[i];
+    return totals[std::min(ab_min ? ab_min - 1 : 0, totals.size() - 1)];
+  }
+
+  void run_manifest::check(std::size_t p) const
+  {
+    for (std::size_t i = 0; i < m_partitions[p].size(); i++)
+    {
+      const std::string& file = m_partitions[p][i];
+      std::error_code ec;
+      std::uint64_t size = fs::file_size(file, ec);
+      std::int64_t time = ec ? 0 : fs::last_write_time(file, ec).time_since_epoch().count();
+
+      if (!ec && size == m_stats[p][i].size && time == m_stats[p][i].mtime)
+        continue;
+
+      // Touched so that the run key changes.
+      fs::path dir = fs::path(file).parent_path();
+      auto dir_time = fs::last_write_time(dir, ec);
+      if (!ec)
+        fs::last_write_time(dir, std::max(fs::file_time_type::clock::now(),
+                                          dir_time + std::chrono::seconds(1)), ec);
+
+      throw IOError(fmt::format("{} changed since the run was indexed, run kmdiff again.", file));
+    }
+  }
+
+  void run_manifest::build(const std::string& run_dir)
+  {
+    bind_run(run_dir);
+    m_config = get_kmtricks_config(run_dir);
+
+    for (auto& sample : get_fofs(run_dir))
+    {
+      m_ids.push_back(std::get<0>(sample));
+      std::uint32_t ab_min = std::get<2>(sample);
+      m_ab_mins.push_back(ab_min ? ab_min : m_config.abundance_min);
+    }
+
+    m_totals.resize(m_ids.size());
+    m_partitions.resize(m_config.nb_partitions);
+    m_sizes.resize(m_config.nb_partitions, 0);
+    m_stats.resize(m_config.nb_partitions);
+
+    ThreadPool pool(s_nb_threads);
+    std::exception_ptr ep = nullptr;
+    std::mutex ep_mutex;
+
+    auto guarded = [&ep, &ep_mutex](auto&& f) {
+      try
+      {
+        f();
+      }
+      catch (...)
+      {
+        std::unique_lock<std::mutex> lock(ep_mutex);
+        if (!ep) ep = std::current_exception();
+      }
+    };
+
+    // totals[a - 1]: k-mers with an abundance >= a.
+    for (std::size_t i = 0; i < m_ids.size(); i++)
+    {
+      pool.add_task([this, i, &guarded](int id) {
+        unused(id);
+        guarded([this, i]() {
+          km::HistReader hr(km::KmDir::get().get_hist_path(m_ids[i]));
+          auto hist = hr.get();
+          auto& v = hist->get_vec();
+
+          auto& totals = m_totals[i];
+          totals.resize(v.size() + 1);
+          totals[0] = hr.infos().total;
+          for (std::size_t j = 1; j <= v.size(); j++)
+            totals[j] = totals[j - 1] - j * v[j - 1];
+        });
+      });
+    }
+
+    for (std::size_t p = 0; p < m_partitions.size(); p++)
+    {
+      pool.add_task([this, p, &guarded](int id) {
+        unused(id);
+        guarded([this, p]() {
+          m_partitions[p] = km::KmDir::get().get_files_to_merge(p, true, km::KM_FILE::KMER);
+          for (auto& path : m_partitions[p])
+          {
+            std::error_code ec;
+            file_stat stat;
+            stat.size = fs::file_size(path, ec);
+            if (!ec)
+              stat.mtime = fs::last_write_time(path, ec).time_since_epoch().count();
+            if (ec)
+              stat = file_stat();
+            m_sizes[p] += stat.size;
+            m_stats[p].push_back(stat);
+          }
+        });
+      });
+    }
+
+    pool.join_all();
+
+    if (ep)
+      std::rethrow_exception(ep);
+  }
+
+  // Paths under the run are stored relative to it, so that the cache survives a moved run.
+  bool run_manifest::load(const std::string& path, std::uint64_t key)
+  {
+    std::ifstream in(path, std::ios::in | std::ios::binary);
+    if (!in.good())
+      return false;
+
+    if (read_value<int>(in) != s_version || read_value<std::uint64_t>(in) != key || !in)
+      return false;
+
+    std::string root = fs::path(path).parent_path().string() + "/";
+
+    // No length can exceed the size of the file.
+    std::error_code ec;
+    std::uint64_t max = fs::file_size(path, ec);
+    if (ec)
+      return false;
+
+    m_config.kmer_size = read_value<std::uint64_t>(in);
+    m_config.nb_partitions = read_value<std::uint64_t>(in);
+    m_config.abundance_min = read_value<std::uint64_t>(in);
+
+    std::uint64_t nb_samples = read_length(in, max);
+    for (std::uint64_t i = 0; i < nb_samples && in; i++)
+    {
+      m_ids.push_back(read_string(in, max));
+      m_ab_mins.push_back(read_value<std::uint32_t>(in));
+      m_totals.emplace_back(read_length(in, max / sizeof(std::uint64_t)));
+      in.read(reinterpret_cast<char*>(m_totals.back().data()),
+              m_totals.back().size() * sizeof(std::uint64_t));
+    }
+
+    std::uint64_t nb_partitions = read_length(in, max);
+    for (std::uint64_t p = 0; p < nb_partitions && in; p++)
+    {
+      m_sizes.push_back(read_value<std::uint64_t>(in));
+      m_partitions.emplace_back(read_length(in, max / sizeof(std::uint64_t)));
+      m_stats.emplace_back(m_partitions.back().size());
+      for (std::size_t i = 0; i < m_partitions.back().size(); i++)
+      {
+        std::string& file = m_partitions.back()[i];
+        file = read_string(in, max);
+        if (fs::path(file).is_relative())
+          file = root + file;
+        m_stats.back()[i].size = read_value<std::uint64_t>(in);
+        m_stats.back()[i].mtime = read_value<std::int64_t>(in);
+      }
+    }
+
+    if (!in || nb_partitions != m_config.nb_partitions)
+    {
+      *this = run_manifest();
+      return false;
+    }
+
+    return true;
+  }
+
+  void run_manifest::save(const std::string& path, std::uint64_t key) const
+  {
+    std::string tmp = path + ".tmp";
+    std::string root = fs::path(path).parent_path().string() + "/";
+
+    {
+      std::ofstream out(tmp, std::ios::out | std::ios::binary); check_fstream_good(tmp, out);
+
+      write_value<int>(out, s_version);
+      write_value<std::uint64_t>(out, key);
+
+      write_value<std::uint64_t>(out, m_config.kmer_size);
+      write_value<std::uint64_t>(out, m_config.nb_partitions);
+      write_value<std::uint64_t>(out, m_config.abundance_min);
+
+      write_value<std::uint64_t>(out, m_ids.size());
+      for (std::size_t i = 0; i < m_ids.size(); i++)
+      {
+        write_string(out, m_ids[i]);
+        write_value<std::uint32_t>(out, m_ab_mins[i]);
+        write_value<std::uint64_t>(out, m_totals[i].size());
+        out.write(reinterpret_cast<const char*>(m_totals[i].data()),
+                  m_totals[i].size() * sizeof(std::uint64_t));
+      }
+
+      write_value<std::uint64_t>(out, m_partitions.size());
+      for (std::size_t p = 0; p < m_partitions.size(); p++)
+      {
+        write_value<std::uint64_t>(out, m_sizes[p]);
+        write_value<std::uint64_t>(out, m_partitions[p].size());
+        for (std::size_t i = 0; i < m_partitions[p].size(); i++)
+        {
+          const std::string& file = m_partitions[p][i];
+          write_string(out, file.rfind(root, 0) == 0 ? file.substr(root.size()) : file);
+          write_value<std::uint64_t>(out, m_stats[p][i].size);
+          write_value<std::int64_t>(out, m_stats[p][i].mtime);
+        }
+      }
+
+      check_fstream_good(tmp, out);
+    }
+
+    fs::rename(tmp, path);
   }
 
 } // end of namespace kmdiff
@@ -1,4 +1,6 @@
 #define _USE_MATH_DEFINES
+#include <algorithm>
+#include <cassert>
 #include <iomanip>
 #include <cmath>
 #include <iostream>
@@ -65,6 +67,126 @@ namespace kmdiff {
     return std::fabs(x-y) < e;
   }
 
+  dense_matrix::dense_matrix(const matrix_t& m)
+    : m_rows(nrows(m)), m_cols(m.empty() ? 0 : ncols(m))
+  {
+    m_data.reserve(m_rows * m_cols);
+    for (auto& row : m)
+      m_data.insert(m_data.end(), row.begin(), row.end());
+  }
+
+  matrix_t dense_matrix::to_matrix() const
+  {
+    matrix_t m(m_rows);
+    for (size_t i=0; i<m_rows; i++)
+      m[i].assign((*this)[i], (*this)[i] + m_cols);
+    return m;
+  }
+
+  void glm_workspace::init(size_t n, size_t p)
+  {
+    eta.resize(n);
+    mu.resize(n);
+    s.resize(n);
+    z.resize(n);
+    v.resize(p);
+    w.resize(p);
+    hessian.assign(p, p);
+  }
+
+  size_t nrows(const dense_matrix& m)
+  {
+    return m.rows();
+  }
+
+  size_t ncols(const dense_matrix& m)
+  {
+    return m.cols();
+  }
+
+  std::string str_matrix(const dense_matrix& m)
+  {
+    return str_matrix(m.to_matrix());
+  }
+
+  void multiply(const dense_matrix& m1, const dense_matrix& m2, dense_matrix& res)
+  {
+    constexpr size_t block = 64;
+    const size_t n = nrows(m1), p = ncols(m1), q = ncols(m2);
+    assert(p == nrows(m2));
+    res.assign(n, q);
+
+    // i-k-j order on blocks of k: the inner loop streams contiguous rows of m2 and res.
+    for (size_t kb=0; kb<p; kb+=block)
+    {
+      const size_t ke = std::min(kb + block, p);
+      for (size_t i=0; i<n; i++)
+      {
+        double* r = res[i];
+        const double* a = m1[i];
+        for (size_t k=kb; k<ke; k++)
+        {
+          const double aik = a[k];
+          const double* b = m2[k];
+          for (size_t j=0; j<q; j++)
+            r[j] += aik * b[j];
+        }
+      }
+    }
+  }
+
+  void xtwx(const dense_matrix& x, const double* w, dense_matrix& res)
+  {
+    const size_t n = nrows(x), p = ncols(x);
+    res.assign(p, p);
+
+    // Accumulates the upper triangle row by row, then mirrors it.
+    for (size_t i=0; i<n; i++)
+    {
+      const double* xi = x[i];
+      const double wi = w ? w[i] : 1.0;
+      if (wi == 0.0)
+        continue;
+      for (size_t j=0; j<p; j++)
+      {
+        const double a = wi * xi[j];
+        double* r = res[j];
+        for (size_t k=j; k<p; k++)
+          r[k] += a * xi[k];
+      }
+    }
+
+    for (size_t j=0; j<p; j++)
+      for (size_t k=0; k<j; k++)
+        res[j][k] = res[k][j];
+  }
+
+  void xtv(const dense_matrix& x, const double* v, double* res)
+  {
+    const size_t n = nrows(x), p = ncols(x);
+    std::fill(res, res + p, 0.0);
+    for (size_t i=0; i<n; i++)
+    {
+      const double* xi = x[i];
+      const double vi = v[i];
+      for (size_t j=0; j<p; j++)
+        res[j] += xi[j] * vi;
+    }
+  }
+
+  void xv(const dense_matrix& x, const double* v, double* res)
+  {
+    const size_t n = nrows(x), p = ncols(x);
+    for (size_t i=0; i<n; i++)
+    {
+      const double* xi = x[i];
+      double s = 0.0;
+      for (size_t j=0; j<p; j++)
+        s += xi[j] * v[j];
+      res[i] = s;
+    }
+  }
+
   matrix_t transpose(const matrix_t& m)
   {
     matrix_t trp (ncols(m), vector_t(nrows(m)));
@@ -188,10 +310,70 @@ namespace kmdiff {
     return std::make_tuple(inv, singular, nan);
   }
 
+  std::tuple<bool, bool> cholesky_factor(dense_matrix& m)
+  {
+    const size_t n = nrows(m);
+
+    for (size_t j=0; j<n; j++)
+    {
+      double* mj = m[j];
+      double d = mj[j];
+      for (size_t k=0; k<j; k++)
+        d -= mj[k] * mj[k];
+
+      if (std::isnan(d))
+        return std::make_tuple(false, true);
+      if (d <= 0.0)
+        return std::make_tuple(true, false);
+
+      d = std::sqrt(d);
+      mj[j] = d;
+
+      for (size_t i=j+1; i<n; i++)
+      {
+        double* mi = m[i];
+        double s = mi[j];
+        for (size_t k=0; k<j; k++)
+          s -= mi[k] * mj[k];
+        mi[j] = s / d;
+      }
+    }
+
+    return std::make_tuple(false, false);
+  }
+
+  void cholesky_substitute(const dense_matrix& l, double* b)
+  {
+    const size_t n = nrows(l);
+
+    // L.y = b, then Lt.x = y
+    for (size_t i=0; i<n; i++)
+    {
+      double s = b[i];
+      for (size_t k=0; k<i; k++)
+        s -= l[i][k] * b[k];
+      b[i] = s / l[i][i];
+    }
+    for (size_t i=n; i-- > 0;)
+    {
+      double s = b[i];
+      for (size_t k=i+1; k<n; k++)
+        s -= l[k][i] * b[k];
+      b[i] = s / l[i][i];
+    }
+  }
+
+  std::tuple<bool, bool> cholesky_solve(dense_matrix& m, double* b)
+  {
+    auto [singular, nan] = cholesky_factor(m);
+    if (!singular && !nan)
+      cholesky_substitute(m, b);
+    return std::make_tuple(singular, nan);
+  }
+
   double sigmoid(double x)
   {
-    double e = M_E;
-    return 1.0 / (1.0 + std::pow(e, -x));
+    return 1.0 / (1.0 + std::exp(-x));
   }
 
   double linear_predictor(const vector_t& model, const vector_t& data)
@@ -210,80 +392,116 @@ namespace kmdiff {
     return sigmoid(s);
   }
 
+  double log_sigmoid(double x)
+  {
+    if (x < 0)
+      return x - std::log1p(std::exp(x));
+    return -std::log1p(std::exp(-x));
+  }
+
+  // Bernoulli log-likelihood of y under the logistic model, log(1 - sigmoid(x)) = log_sigmoid(-x).
+  double log_likelihood(const vector_t& model, const matrix_t& x, const vector_t& y)
+  {
+    double ll = 0.0;
+    for (size_t i=0; i<nrows(x); i++)
+    {
+      double s = linear_predictor(model, x[i]);
+      ll += y[i] == 1 ? log_sigmoid(s) : log_sigmoid(-s);
+    }
+    return ll;
+  }
+
+  double log_likelihood(const vector_t& model, const dense_matrix& x, const vector_t& y)
+  {
+    double ll = 0.0;
+    for (size_t i=0; i<nrows(x); i++)
+    {
+      double s = 0.0;
+      for (size_t j=0; j<model.size(); j++)
+        s += model[j] * x[i][j];
+      ll += y[i] == 1 ? log_sigmoid(s) : log_sigmoid(-s);
+    }
+    return ll;
+  }
+
   std::tuple<vector_t, bool, bool, double, int> glm_newton_raphson(const matrix_t& x,
                                                                    const vector_t& y,
                                                                    double gamma,
                                                                    int max_iters)
   {
-    bool ise = false, ine = false;
-    double re = 0.0;
-    int ein = 0; unused(ein);
+    glm_workspace ws;
+    return glm_newton_raphson(dense_matrix(x), y, gamma, max_iters, ws);
+  }
+
+  std::tuple<vector_t, bool, bool, double, int> glm_irls(const matrix_t& x,
+                                                         const vector_t& y,
+                                                         int max_iters)
+  {
+    glm_workspace ws;
+    return glm_irls(dense_matrix(x), y, max_iters, ws);
+  }
+
+  const glm_fit_t& glm_newton_raphson(const dense_matrix& x,
+                                      const vector_t& y,
+                                      double gamma,
+                                      int max_iters,
+                                      glm_workspace& ws)
+  {
+    auto& [weight_old, ise, ine, re, iter] = ws.fit;
+    ise = false; ine = false;
+    re = 0.0;
+    iter = 0;
     double epsilon = 1e-6;
-    int iter = 0;
-    matrix_t A = x;
-    vector_t weight_old(ncols(A), 0);
-    for (size_t i=0; i<weight_old.size(); i++)
+    const size_t n = nrows(x);
+    const size_t p = ncols(x);
+    ws.init(n, p);
+
+    weight_old.assign(p, 0);
+    for (size_t i=0; i<p; i++)
     {
       double mxx = -10000000000.0;
-      for (size_t j=0; j<nrows(A); j++)
+      for (size_t j=0; j<n; j++)
       {
-        mxx = std::max(mxx, A[j][i]);
+        mxx = std::max(mxx, x[j][i]);
       }
       weight_old[i] = 1.0/mxx;
     }
     double prev_error = 1e18;
-    matrix_t AT = transpose(x);
-    matrix_t A_minus_Y(nrows(A), vector_t(1, 0));
-    vector_t B_proxy(nrows(A), 0);
-    matrix_t ATB(nrows(AT), vector_t(B_proxy.size(), 0));
 
     while (true)
     {
       double error = 0.0;
-      for (size_t i=0; i<nrows(A); i++)
+      xv(x, weight_old.data(), ws.eta.data());
+      for (size_t i=0; i<n; i++)
       {
-        double z_i = 0.0;
-        for (size_t j=0; j<ncols(A); j++)
-        {
-          z_i += A[i][j] * weight_old[j];
-        }
-        double alph_i = sigmoid(z_i);
+        double alph_i = sigmoid(ws.eta[i]);
         error += (y[i]-alph_i)*(y[i]-alph_i);
-        B_proxy[i] = alph_i*(1.0-alph_i);
-        A_minus_Y[i][0] = alph_i-y[i];
+        ws.s[i] = alph_i*(1.0-alph_i);
+        ws.z[i] = alph_i-y[i];
       }
-      error /= nrows(A);
+      error /= n;
       re = error;
       if (std::fabs(error-prev_error) < epsilon)
         break;
 
       prev_error = error;
-      for (size_t i=0; i<nrows(ATB); i++)
-      {
-        for (size_t j=0; j<ncols(ATB); j++)
-        {
-          ATB[i][j] = AT[i][j]*B_proxy[j];
-        }
-      }
 
-      matrix_t toinv = multiply(ATB, A);
+      xtwx(x, ws.s.data(), ws.hessian);
+
+      xtv(x, ws.z.data(), ws.v.data());
 
-      auto [hinv, sing, nan] = inverse(toinv, nrows(toinv));
+      auto [sing, nan] = cholesky_solve(ws.hessian, ws.v.data());
       if (sing || nan)
       {
-        return make_tuple(weight_old, ise, ine, re, iter);
+        return ws.fit;
       }
 
-      matrix_t gradient = multiply(AT, A_minus_Y);
-      matrix_t grad_mul_hinv = multiply(hinv, gradient);
-
-      for (size_t j=0; j<weight_old.size(); j++)
+      for (size_t j=0; j<p; j++)
       {
-        weight_old[j] -= gamma*grad_mul_hinv[j][0];
+        weight_old[j] -= gamma*ws.v[j];
       }
 
       iter += 1;
-      ein = iter;
 
       if (iter >= max_iters)
         break;
@@ -291,80 +509,82 @@ namespace kmdiff {
       prev_error = error;
       re = prev_error;
     }
-    return make_tuple(weight_old, ise, ine, re, iter);
+    return ws.fit;
   }
 
-  std::tuple<vector_t, bool, bool, double, int> glm_irls(const matrix_t& x,
-                                                         const vector_t& y,
-                                                         int max_iters)
+  const glm_fit_t& glm_irls(const dense_matrix& x,
+                            const vector_t& y,
+                            int max_iters,
+                            glm_workspace& ws,
+                            const vector_t& start)
   {
+    auto& [weight, ise, ine, ret_error, iter] = ws.fit;
+    ise = false; ine = false;
+    ret_error = 0.0;
+    iter = 0;
     double epsilon = 1e-6;
-    int iter = 0;
-    int ein = 0;
-    bool ise = false, ine = false;
-    double ret_error;
-    vector_t weight(ncols(x), 1);
-    matrix_t w(ncols(x), vector_t(1, 1));
-    matrix_t X(nrows(x), vector_t(ncols(x), 0));
-    matrix_t eta(nrows(x), vector_t(1, 0));
-    matrix_t mu(nrows(x), vector_t(1, 0));
-    matrix_t S(nrows(x), vector_t(1, 0));
-    matrix_t z(nrows(x), vector_t(1, 0));
-    matrix_t S_X(nrows(x), vector_t(ncols(x), 0));
-    matrix_t S_z(nrows(x), vector_t(1, 0));
-
-    for (size_t i=0; i<nrows(mu); i++)
+    const size_t n = nrows(x);
+    const size_t p = ncols(x);
+    ws.init(n, p);
+
+    weight.assign(p, 1);
+
+    if (start.empty())
+    {
+      for (size_t i=0; i<n; i++)
+      {
+        ws.mu[i] = (y[i] + 0.5) / 2;
+        ws.eta[i] = log(ws.mu[i]/(1-ws.mu[i]));
+      }
+    }
+    else
     {
-      mu[i][0] = (y[i] + 0.5) / 2;
-      eta[i][0] = log(mu[i][0]/(1-mu[i][0]));
+      // Warm start, e.g. from a nested model padded with zeros.
+      weight = start;
+      xv(x, weight.data(), ws.eta.data());
+      for (size_t i=0; i<n; i++)
+        ws.mu[i] = sigmoid(ws.eta[i]);
     }
     double prev_error = 1e18;
 
     while (true)
     {
-      X.clear();
-      S.clear();
-      S_X.clear();
-      z.clear();
-      S_z.clear();
-
       double error = 0.0;
       int num_of_good = 0;
-      for (size_t i=0; i<nrows(x); i++)
+
+      // Rows with a vanishing variance are left out of the fit with a null weight.
+      for (size_t i=0; i<n; i++)
       {
-        double g_i = mu[i][0] * (1.0 - mu[i][0]);
+        double g_i = ws.mu[i] * (1.0 - ws.mu[i]);
         if (g_i > 1e-305)
         {
           num_of_good++;
-          X.push_back(x[i]);
-          z.push_back(vector_t(1, eta[i][0] + (y[i] - mu[i][0]) / (g_i + 1e-305)));
-          S.push_back(vector_t(1, g_i));
+          ws.s[i] = g_i;
+          ws.z[i] = g_i * ws.eta[i] + (y[i] - ws.mu[i]);
         }
-        error += (y[i] - mu[i][0]) * (y[i] - mu[i][0]);
+        else
+        {
+          ws.s[i] = 0.0;
+          ws.z[i] = 0.0;
+        }
+        error += (y[i] - ws.mu[i]) * (y[i] - ws.mu[i]);
       }
       if (num_of_good == 0)
         break;
 
-      error /= nrows(x);
+      error /= n;
       ret_error = error;
 
       if (std::fabs(error - prev_error) < epsilon)
         break;
 
       prev_error = error;
-      matrix_t X_T = transpose(X);
-      for (size_t i=0; i<nrows(S); i++)
-      {
-        S_X.push_back(vector_t(ncols(X), 0));
-        for (size_t j=0; j<ncols(X); j++)
-        {
-          S_X[i][j] = S[i][0] * X[i][j];
-        }
-      }
 
-      matrix_t hessian = multiply(X_T, S_X);
+      xtwx(x, ws.s.data(), ws.hessian);
+
+      xtv(x, ws.z.data(), ws.w.data());
 
-      auto [hessian_inv, sing, nan] = inverse(hessian, nrows(hessian));
+      auto [sing, nan] = cholesky_solve(ws.hessian, ws.w.data());
       if (sing || nan)
       {
         ise = sing;
@@ -373,15 +593,7 @@ namespace kmdiff {
         break;
       }
 
-      for (size_t i=0; i<nrows(z); i++)
-      {
-        S_z.push_back(vector_t(1, S[i][0] * z[i][0]));
-      }
-      matrix_t XTSz = multiply(X_T, S_z);
-      w = multiply(hessian_inv, XTSz);
-
       iter += 1;
-      ein = iter;
 
       if (iter >= max_iters)
       {
@@ -391,22 +603,422 @@ namespace kmdiff {
       prev_error = error;
       ret_error = prev_error;
 
-      for (size_t i=0; i<weight.size(); i++)
-        weight[i] = w[i][0];
+      std::copy(ws.w.begin(), ws.w.end(), weight.begin());
+
+      xv(x, ws.w.data(), ws.eta.data());
+      for (size_t i=0; i<n; i++)
+        ws.mu[i] = sigmoid(ws.eta[i]);
+    }
+    return ws.fit;
+  }
 
-      spdlog::debug("Work eta {} {} x {} {} mu {} {} w {} {}", nrows(eta), ncols(eta), nrows(x), ncols(x), nrows(mu), ncols(mu), nrows(w), ncols(w));
-      for (size_t i=0; i<nrows(x); i++)
+
+  score_test::score_test(const dense_matrix& x, const vector_t& y, const vector_t& model)
+    : m_x(x), m_w(nrows(x)), m_r(nrows(x))
+  {
+    const size_t n = nrows(x);
+    vector_t eta(n);
+    xv(x, model.data(), eta.data());
+
+    for (size_t i=0; i<n; i++)
+    {
+      const double mu = sigmoid(eta[i]);
+      m_w[i] = mu * (1.0 - mu);
+      m_r[i] = y[i] - mu;
+    }
+
+    xtwx(x, m_w.data(), m_info);
+    auto [singular, nan] = cholesky_factor(m_info);
+    m_valid = !singular && !nan;
+  }
+
+  double score_test::statistic(const double* c, vector_t& v) const
+  {
+    if (!m_valid)
+      return 0.0;
+
+    const size_t n = nrows(m_x), p = ncols(m_x);
+    v.resize(p);
+    std::fill(v.begin(), v.end(), 0.0);
+
+    double u = 0.0, cwc = 0.0;
+    for (size_t i=0; i<n; i++)
+    {
+      const double wc = m_w[i] * c[i];
+      const double* xi = m_x[i];
+      u += c[i] * m_r[i];
+      cwc += wc * c[i];
+      for (size_t j=0; j<p; j++)
+        v[j] += xi[j] * wc;
+    }
+
+    // vt.(L.Lt)^-1.v = |L^-1.v|^2
+    double q = 0.0;
+    for (size_t j=0; j<p; j++)
+    {
+      double s = v[j];
+      for (size_t k=0; k<j; k++)
+        s -= m_info[j][k] * v[k];
+      v[j] = s / m_info[j][j];
+      q += v[j] * v[j];
+    }
+
+    const double var = cwc - q;
+    if (!(var > 1e-12 * cwc))
+      return 0.0;
+    return u * u / var;
+  }
+
+  batch_irls::batch_irls(const dense_matrix& x, const vector_t& y)
+    : m_x(x), m_y(y), m_n(nrows(x)), m_p(ncols(x) + 1)
+  {
+    m_xx.assign(m_n, m_p * m_p);
+    for (size_t i=0; i<m_n; i++)
+      for (size_t j=0; j<m_p-1; j++)
+        for (size_t k=j; k<m_p-1; k++)
+          m_xx[i][idx(j, k)] = x[i][j] * x[i][k];
+  }
+
+  void batch_irls::fit(const dense_matrix& cols,
+                       int max_iters,
+                       std::vector<glm_fit_t>& res,
+                       const vector_t& start)
+  {
+    const double epsilon = 1e-6;
+    const size_t n = m_n, p = m_p, L = nrows(cols), last = p - 1;
+    m_lanes = L;
+
+    m_c.assign(n, L);
+    m_eta.assign(n, L);
+    m_mu.assign(n, L);
+    m_s.assign(n, L);
+    m_z.assign(n, L);
+    m_h.assign(p * p, L);
+    m_b.assign(p, L);
+    m_w.assign(p, L, 1.0);
+    m_error.assign(L, 0);
+    m_prev_error.assign(L, 1e18);
+    m_good.assign(L, 0);
+    m_active.assign(L, 1);
+    m_failed.assign(L, 0);
+    m_map.resize(L);
+    for (size_t l=0; l<L; l++)
+      m_map[l] = l;
+
+    res.resize(L);
+    for (auto& [weight, ise, ine, ret_error, iter] : res)
+    {
+      if (start.empty())
+        weight.assign(p, 1);
+      else
+        weight = start;
+      ise = false; ine = false;
+      ret_error = 0.0;
+      iter = 0;
+    }
+
+    for (size_t l=0; l<L; l++)
+      for (size_t i=0; i<n; i++)
+        m_c[i][l] = cols[l][i];
+    m_cw = m_c;
+
+    if (start.empty())
+    {
+      for (size_t i=0; i<n; i++)
+      {
+        const double mu = (m_y[i] + 0.5) / 2;
+        const double eta = log(mu / (1 - mu));
+        for (size_t l=0; l<L; l++)
+        {
+          m_mu[i][l] = mu;
+          m_eta[i][l] = eta;
+        }
+      }
+    }
+    else
+    {
+      for (size_t j=0; j<p; j++)
+        std::fill(m_w[j], m_w[j] + L, start[j]);
+
+      for (size_t i=0; i<n; i++)
+      {
+        double shared = 0.0;
+        for (size_t j=0; j<last; j++)
+          shared += m_x[i][j] * start[j];
+        for (size_t l=0; l<L; l++)
+        {
+          m_eta[i][l] = shared + m_cw[i][l] * start[last];
+          m_mu[i][l] = sigmoid(m_eta[i][l]);
+        }
+      }
+    }
+
+    // Finished lanes are dropped from the buffers, see compact().
+    size_t nb_active = L;
+    size_t nb_lanes = L;
+
+    while (nb_active)
+    {
+      std::fill(m_error.begin(), m_error.begin() + nb_lanes, 0.0);
+      std::fill(m_good.begin(), m_good.begin() + nb_lanes, 0.0);
+
+      for (size_t i=0; i<n; i++)
+      {
+        const double y = m_y[i];
+        const double* mu = m_mu[i];
+        const double* eta = m_eta[i];
+        double* s = m_s[i];
+        double* z = m_z[i];
+        for (size_t l=0; l<nb_lanes; l++)
+        {
+          const double g = mu[l] * (1.0 - mu[l]);
+          const bool good = g > 1e-305;
+          s[l] = good ? g : 0.0;
+          z[l] = good ? g * eta[l] + (y - mu[l]) : 0.0;
+          m_good[l] += good;
+          m_error[l] += (y - mu[l]) * (y - mu[l]);
+        }
+      }
+
+      for (size_t l=0; l<nb_lanes; l++)
+      {
+        if (!m_active[l])
+          continue;
+
+        if (m_good[l] == 0)
+        {
+          m_active[l] = 0; nb_active--;
+          continue;
+        }
+
+        const double error = m_error[l] / n;
+        std::get<3>(res[m_map[l]]) = error;
+
+        if (std::fabs(error - m_prev_error[l]) < epsilon)
+        {
+          m_active[l] = 0; nb_active--;
+          continue;
+        }
+        m_prev_error[l] = error;
+      }
+
+      if (!nb_active)
+        break;
+
+      // Upper triangle of Xt.S.X and Xt.S.z for all lanes.
+      std::fill(m_h.data(), m_h.data() + p * p * L, 0.0);
+      std::fill(m_b.data(), m_b.data() + p * L, 0.0);
+
+      for (size_t i=0; i<n; i++)
+      {
+        const double* xi = m_x[i];
+        const double* xx = m_xx[i];
+        const double* s = m_s[i];
+        const double* z = m_z[i];
+        const double* c = m_cw[i];
+
+        for (size_t j=0; j<last; j++)
+        {
+          for (size_t k=j; k<last; k++)
+          {
+            const double xjk = xx[idx(j, k)];
+            double* h = m_h[idx(j, k)];
+            for (size_t l=0; l<nb_lanes; l++)
+              h[l] += s[l] * xjk;
+          }
+
+          const double xij = xi[j];
+          double* h = m_h[idx(j, last)];
+          double* b = m_b[j];
+          for (size_t l=0; l<nb_lanes; l++)
+          {
+            h[l] += s[l] * c[l] * xij;
+            b[l] += z[l] * xij;
+          }
+        }
+
+        double* h = m_h[idx(last, last)];
+        double* b = m_b[last];
+        for (size_t l=0; l<nb_lanes; l++)
+        {
+          h[l] += s[l] * c[l] * c[l];
+          b[l] += z[l] * c[l];
+        }
+      }
+
+      // H = Rt.R with R upper triangular stored in place, then Rt.y = b and R.x = y.
+      std::fill(m_failed.begin(), m_failed.begin() + nb_lanes, 0);
+      for (size_t j=0; j<p; j++)
+      {
+        double* hjj = m_h[idx(j, j)];
+        for (size_t k=0; k<j; k++)
+        {
+          const double* hkj = m_h[idx(k, j)];
+          for (size_t l=0; l<nb_lanes; l++)
+            hjj[l] -= hkj[l] * hkj[l];
+        }
+        for (size_t l=0; l<nb_lanes; l++)
+        {
+          if (std::isnan(hjj[l]))
+            m_failed[l] = 2;
+          else if (hjj[l] <= 0.0 && !m_failed[l])
+            m_failed[l] = 1;
+          hjj[l] = m_failed[l] ? 1.0 : std::sqrt(hjj[l]);
+        }
+        for (size_t i=j+1; i<p; i++)
+        {
+          double* hji = m_h[idx(j, i)];
+          for (size_t k=0; k<j; k++)
+          {
+            const double* hkj = m_h[idx(k, j)];
+            const double* hki = m_h[idx(k, i)];
+            for (size_t l=0; l<nb_lanes; l++)
+              hji[l] -= hkj[l] * hki[l];
+          }
+          for (size_t l=0; l<nb_lanes; l++)
+            hji[l] /= hjj[l];
+        }
+      }
+
+      for (size_t j=0; j<p; j++)
+      {
+        double* bj = m_b[j];
+        for (size_t k=0; k<j; k++)
+        {
+          const double* hkj = m_h[idx(k, j)];
+          const double* bk = m_b[k];
+          for (size_t l=0; l<nb_lanes; l++)
+            bj[l] -= hkj[l] * bk[l];
+        }
+        const double* hjj = m_h[idx(j, j)];
+        for (size_t l=0; l<nb_lanes; l++)
+          bj[l] /= hjj[l];
+      }
+      for (size_t j=p; j-- > 0;)
+      {
+        double* bj = m_b[j];
+        for (size_t k=j+1; k<p; k++)
+        {
+          const double* hjk = m_h[idx(j, k)];
+          const double* bk = m_b[k];
+          for (size_t l=0; l<nb_lanes; l++)
+            bj[l] -= hjk[l] * bk[l];
+        }
+        const double* hjj = m_h[idx(j, j)];
+        for (size_t l=0; l<nb_lanes; l++)
+          bj[l] /= hjj[l];
+      }
+
+      for (size_t l=0; l<nb_lanes; l++)
+      {
+        if (!m_active[l])
+          continue;
+
+        auto& [weight, ise, ine, ret_error, iter] = res[m_map[l]];
+
+        if (m_failed[l])
+        {
+          ise = m_failed[l] == 1;
+          ine = m_failed[l] == 2;
+          ret_error = m_prev_error[l];
+          m_active[l] = 0; nb_active--;
+          continue;
+        }
+
+        iter += 1;
+        if (iter >= max_iters)
+        {
+          m_active[l] = 0; nb_active--;
+          continue;
+        }
+
+        ret_error = m_prev_error[l];
+        for (size_t j=0; j<p; j++)
+        {
+          weight[j] = m_b[j][l];
+          m_w[j][l] = m_b[j][l];
+        }
+      }
+
+      if (!nb_active)
+        break;
+
+      if (nb_active < nb_lanes)
+      {
+        compact(nb_lanes);
+        nb_lanes = nb_active;
+      }
+
+      for (size_t i=0; i<n; i++)
       {
-        eta[i][0] = 0;
-        for (size_t j=0; j<ncols(x); j++)
+        const double* xi = m_x[i];
+        const double* c = m_cw[i];
+        double* eta = m_eta[i];
+        double* mu = m_mu[i];
+        for (size_t l=0; l<nb_lanes; l++)
+          eta[l] = c[l] * m_w[last][l];
+        for (size_t j=0; j<last; j++)
         {
-          eta[i][0] += x[i][j] * w[j][0];
+          const double* wj = m_w[j];
+          for (size_t l=0; l<nb_lanes; l++)
+            eta[l] += xi[j] * wj[l];
         }
-        mu[i][0] = sigmoid(eta[i][0]);
+        for (size_t l=0; l<nb_lanes; l++)
+          mu[l] = sigmoid(eta[l]);
       }
-      spdlog::debug("crash");
     }
-    return std::make_tuple(weight, ise, ine, ret_error, ein);
+  }
+
+  void batch_irls::compact(size_t nb_lanes)
+  {
+    size_t a = 0;
+    for (size_t l=0; l<nb_lanes; l++)
+    {
+      if (!m_active[l])
+        continue;
+      if (a != l)
+      {
+        for (size_t i=0; i<m_n; i++)
+        {
+          m_cw[i][a] = m_cw[i][l];
+          m_eta[i][a] = m_eta[i][l];
+          m_mu[i][a] = m_mu[i][l];
+        }
+        for (size_t j=0; j<m_p; j++)
+          m_w[j][a] = m_w[j][l];
+        m_prev_error[a] = m_prev_error[l];
+        m_map[a] = m_map[l];
+        m_active[a] = 1;
+        m_active[l] = 0;
+      }
+      a++;
+    }
+  }
+
+  void batch_irls::log_likelihoods(const std::vector<glm_fit_t>& res, vector_t& ll)
+  {
+    const size_t L = m_lanes, last = m_p - 1;
+    assert(res.size() == L);
+
+    for (size_t l=0; l<L; l++)
+      for (size_t j=0; j<m_p; j++)
+        m_w[j][l] = std::get<0>(res[l])[j];
+
+    ll.assign(L, 0.0);
+    vector_t& eta = m_eta_l;
+    eta.resize(L);
+    for (size_t i=0; i<m_n; i++)
+    {
+      const double* xi = m_x[i];
+      const double* c = m_c[i];
+      for (size_t l=0; l<L; l++)
+        eta[l] = c[l] * m_w[last][l];
+      for (size_t j=0; j<last; j++)
+        for (size_t l=0; l<L; l++)
+          eta[l] += xi[j] * m_w[j][l];
+      for (size_t l=0; l<L; l++)
+        ll[l] += m_y[i] == 1 ? log_sigmoid(eta[l]) : log_sigmoid(-eta[l]);
+    }
   }
 
 } // end of namespace kmdiff
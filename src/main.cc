@@ -48,6 +48,7 @@
   }
 
 KM_EXEC_HELPER(main_diff_exec, kmdiff::main_diff);
+KM_EXEC_HELPER(main_diff_merge_exec, kmdiff::main_diff_merge);
 
 int main(int argc, char* argv[])
 {
@@ -75,6 +76,11 @@ int main(int argc, char* argv[])
       km::const_loop_executor<0, KMER_N>::exec<main_diff_exec>(c.kmer_size, options);
       //main_diff(options);
     }
+    else if (cmd == COMMAND::DIFF_MERGE)
+    {
+      auto shards = load_shards(std::static_pointer_cast<struct diff_options>(options)->output_directory);
+      km::const_loop_executor<0, KMER_N>::exec<main_diff_merge_exec>(shards.front().kmer_size, options);
+    }
     else if (cmd == COMMAND::INFOS)
     {
       main_infos();
@@ -0,0 +1,434 @@
+/*****************************************************************************
+ *   kmdiff
+ *   Authors: T. Lemane
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+#include <fmt/format.h>
+
+#include <kmdiff/pca.hpp>
+#include <kmdiff/threadpool.hpp>
+#include <kmdiff/exceptions.hpp>
+#include <kmdiff/utils.hpp>
+
+namespace kmdiff {
+
+  std::size_t eig_record_size(std::size_t nb_samples)
+  {
+    return std::max<std::size_t>(48, (nb_samples * 2 + 7) / 8);
+  }
+
+  geno_matrix::geno_matrix(const std::string& path, std::size_t nb_samples)
+    : m_cols(nb_samples), m_record(eig_record_size(nb_samples))
+  {
+    std::ifstream in(path, std::ios::in | std::ios::binary);
+    check_fstream_good(path, in);
+
+    char magic[4] = {0};
+    in.read(magic, 4);
+    bool packed = in.gcount() == 4 && std::memcmp(magic, "GENO", 4) == 0;
+    in.clear();
+    in.seekg(0);
+
+    if (packed)
+      load_packed(in, path);
+    else
+      load_text(in, path);
+  }
+
+  void geno_matrix::load_packed(std::ifstream& in, const std::string& path)
+  {
+    std::string header(m_record, '\0');
+    in.read(header.data(), m_record);
+
+    std::size_t nb_samples = 0;
+    std::size_t nb_rows = 0;
+    if (std::sscanf(header.c_str(), "GENO %zu %zu", &nb_samples, &nb_rows) != 2)
+      throw EigenStratError(fmt::format("{}: bad header.", path));
+
+    if (nb_samples != m_cols)
+      throw EigenStratError(
+        fmt::format("{}: {} samples, {} expected.", path, nb_samples, m_cols));
+
+    m_rows = nb_rows;
+    m_data.resize(m_rows * m_record);
+    in.read(reinterpret_cast<char*>(m_data.data()), m_data.size());
+
+    if (static_cast<std::size_t>(in.gcount()) != m_data.size())
+      throw EigenStratError(fmt::format("{}: truncated file.", path));
+  }
+
+  void geno_matrix::load_text(std::ifstream& in, const std::string& path)
+  {
+    std::vector<std::uint8_t> record(m_record);
+
+    for (std::string line; std::getline(in, line);)
+    {
+      std::fill(record.begin(), record.end(), 0);
+      std::size_t j = 0;
+      for (char c : line)
+      {
+        if (c < '0' || c > '9')
+          continue;
+        std::uint8_t g = c == '9' ? 3 : static_cast<std::uint8_t>(c - '0');
+        if (g > 3 || j >= m_cols)
+          throw EigenStratError(fmt::format("{}: bad row {}.", path, m_rows));
+        record[j >> 2] |= g << (6 - 2 * (j & 3));
+        j++;
+      }
+
+      if (j == 0)
+        continue;
+      if (j != m_cols)
+        throw EigenStratError(fmt::format("{}: bad row {}.", path, m_rows));
+
+      m_data.insert(m_data.end(), record.begin(), record.end());
+      m_rows++;
+    }
+  }
+
+  randomized_pca::randomized_pca(const geno_matrix& geno, std::size_t ploidy, std::size_t nb_threads)
+    : m_geno(geno), m_nb_threads(nb_threads), m_values(geno.rows() * 4, 0)
+  {
+    for (std::size_t i = 0; i < m_geno.rows(); i++)
+    {
+      std::size_t counts[4] = {0, 0, 0, 0};
+      const std::uint8_t* row = m_geno[i];
+      for (std::size_t j = 0; j < m_geno.cols(); j++)
+        counts[geno_matrix::at(row, j)]++;
+
+      double ysum = counts[1] + 2.0 * counts[2];
+      double ycount = counts[0] + counts[1] + counts[2];
+
+      if (ycount == 0)
+        continue;
+
+      double mean = ysum / ycount;
+      double p = (ysum + 1.0) / (ploidy * ycount + 2.0);
+      double scale = 1.0 / std::sqrt(p * (1.0 - p));
+
+      for (std::size_t g = 0; g < 3; g++)
+        m_values[4 * i + g] = (g - mean) * scale;
+    }
+  }
+
+  void randomized_pca::covariance_product(const dense_matrix& q, dense_matrix& res) const
+  {
+    const std::size_t n = m_geno.cols();
+    const std::size_t l = q.cols();
+    const std::size_t rows = m_geno.rows();
+    const std::size_t nb_bytes = (n + 3) / 4;
+    const std::size_t nb_slices = std::max<std::size_t>(1, std::min(s_nb_slices, rows));
+
+    vector_t colsum(l, 0);
+    for (std::size_t j = 0; j < n; j++)
+      for (std::size_t c = 0; c < l; c++)
+        colsum[c] += q[j][c];
+
+    // Values are written as v0 + d, where v0 is the value of genotype 0 in the row. The v0 part
+    // is a rank-one term accumulated in base, only the other genotypes are visited.
+    std::vector<dense_matrix> acc(nb_slices);
+    std::vector<vector_t> base(nb_slices);
+
+    {
+      ThreadPool pool(m_nb_threads);
+
+      for (std::size_t s = 0; s < nb_slices; s++)
+      {
+        auto task = [&, s](int) {
+          dense_matrix& a = acc[s];
+          vector_t& b = base[s];
+          a.assign(n, l);
+          b.assign(l, 0);
+
+          vector_t t(l);
+          std::vector<std::pair<std::size_t, double>> nz;
+
+          for (std::size_t i = rows * s / nb_slices; i < rows * (s + 1) / nb_slices; i++)
+          {
+            const double* v = &m_values[4 * i];
+            const std::uint8_t* row = m_geno[i];
+
+            nz.clear();
+            for (std::size_t byte = 0; byte < nb_bytes; byte++)
+            {
+              if (!row[byte])
+                continue;
+              for (std::size_t j = byte * 4; j < std::min(n, byte * 4 + 4); j++)
+              {
+                std::uint8_t g = geno_matrix::at(row, j);
+                if (g)
+                  nz.emplace_back(j, v[g] - v[0]);
+              }
+            }
+
+            for (std::size_t c = 0; c < l; c++)
+              t[c] = v[0] * colsum[c];
+
+            for (auto& [j, d] : nz)
+            {
+              const double* qj = q[j];
+              for (std::size_t c = 0; c < l; c++)
+                t[c] += d * qj[c];
+            }
+
+            for (std::size_t c = 0; c < l; c++)
+              b[c] += v[0] * t[c];
+
+            for (auto& [j, d] : nz)
+            {
+              double* aj = a[j];
+              for (std::size_t c = 0; c < l; c++)
+                aj[c] += d * t[c];
+            }
+          }
+        };
+        pool.add_task(task);
+      }
+
+      pool.join_all();
+    }
+
+    res.assign(n, l);
+    vector_t b(l, 0);
+    for (std::size_t s = 0; s < nb_slices; s++)
+    {
+      const double* a = acc[s].data();
+      double* r = res.data();
+      for (std::size_t k = 0; k < n * l; k++)
+        r[k] += a[k];
+      for (std::size_t c = 0; c < l; c++)
+        b[c] += base[s][c];
+    }
+
+    for (std::size_t j = 0; j < n; j++)
+      for (std::size_t c = 0; c < l; c++)
+        res[j][c] += b[c];
+  }
+
+  pca_result randomized_pca::run(std::size_t npc, std::uint64_t seed) const
+  {
+    const std::size_t n = m_geno.cols();
+    const std::size_t k = std::min(npc, n);
+    const std::size_t l = std::min(n, k + s_oversampling);
+
+    dense_matrix q(n, l);
+    dense_matrix y;
+    std::size_t iterations = s_power_iterations;
+
+    // With few samples, the whole space is used and the result is exact.
+    if (l == n)
+    {
+      for (std::size_t j = 0; j < n; j++)
+        q[j][j] = 1.0;
+      iterations = 0;
+    }
+    else
+    {
+      std::mt19937_64 gen(seed);
+      std::normal_distribution<double> dist;
+      for (std::size_t j = 0; j < n; j++)
+        for (std::size_t c = 0; c < l; c++)
+          q[j][c] = dist(gen);
+    }
+
+    covariance_product(q, y);
+
+    for (std::size_t it = 0; it < iterations; it++)
+    {
+      orthonormalize(y);
+      covariance_product(y, q);
+      std::swap(q, y);
+    }
+
+    orthonormalize(y);
+    covariance_product(y, q);
+
+    dense_matrix b(l, l);
+    for (std::size_t r = 0; r < l; r++)
+      for (std::size_t c = r; c < l; c++)
+      {
+        double sum = 0;
+        for (std::size_t j = 0; j < n; j++)
+          sum += y[j][r] * q[j][c] + y[j][c] * q[j][r];
+        b[r][c] = b[c][r] = sum * 0.5;
+      }
+
+    vector_t values;
+    dense_matrix vectors;
+    symmetric_eigen(b, values, vectors);
+
+    pca_result res;
+    res.eigenvalues.resize(k);
+    res.eigenvectors.assign(n, vector_t(k, 0));
+
+    const double rows = std::max<std::size_t>(1, m_geno.rows());
+
+    for (std::size_t c = 0; c < k; c++)
+    {
+      res.eigenvalues[c] = values[c] / rows;
+
+      std::size_t imax = 0;
+      for (std::size_t j = 0; j < n; j++)
+      {
+        double sum = 0;
+        for (std::size_t r = 0; r < l; r++)
+          sum += y[j][r] * vectors[r][c];
+        res.eigenvectors[j][c] = sum;
+        if (std::abs(sum) > std::abs(res.eigenvectors[imax][c]))
+          imax = j;
+      }
+
+      // Eigenvectors are defined up to their sign, the largest component is made positive.
+      if (res.eigenvectors[imax][c] < 0)
+        for (std::size_t j = 0; j < n; j++)
+          res.eigenvectors[j][c] = -res.eigenvectors[j][c];
+    }
+
+    return res;
+  }
+
+  void orthonormalize(dense_matrix& m)
+  {
+    for (std::size_t c = 0; c < m.cols(); c++)
+    {
+      double before = 0;
+      for (std::size_t j = 0; j < m.rows(); j++)
+        before += m[j][c] * m[j][c];
+
+      // Two passes, the second one removes what the first one left because of rounding.
+      for (int pass = 0; pass < 2; pass++)
+      {
+        for (std::size_t p = 0; p < c; p++)
+        {
+          double dot = 0;
+          for (std::size_t j = 0; j < m.rows(); j++)
+            dot += m[j][c] * m[j][p];
+          for (std::size_t j = 0; j < m.rows(); j++)
+            m[j][c] -= dot * m[j][p];
+        }
+      }
+
+      double norm = 0;
+      for (std::size_t j = 0; j < m.rows(); j++)
+        norm += m[j][c] * m[j][c];
+
+      double scale = (norm > 1e-20 * before && norm > 0) ? 1.0 / std::sqrt(norm) : 0.0;
+      for (std::size_t j = 0; j < m.rows(); j++)
+        m[j][c] *= scale;
+    }
+  }
+
+  void symmetric_eigen(const dense_matrix& m, vector_t& values, dense_matrix& vectors)
+  {
+    const std::size_t n = m.rows();
+    dense_matrix a = m;
+    dense_matrix v(n, n);
+    for (std::size_t i = 0; i < n; i++)
+      v[i][i] = 1.0;
+
+    double total = 0;
+    for (std::size_t i = 0; i < n * n; i++)
+      total += a.data()[i] * a.data()[i];
+
+    for (int sweep = 0; sweep < 100; sweep++)
+    {
+      double off = 0;
+      for (std::size_t p = 0; p < n; p++)
+        for (std::size_t q = p + 1; q < n; q++)
+          off += a[p][q] * a[p][q];
+
+      if (off <= 1e-30 * total)
+        break;
+
+      for (std::size_t p = 0; p < n; p++)
+      {
+        for (std::size_t q = p + 1; q < n; q++)
+        {
+          if (a[p][q] == 0)
+            continue;
+
+          double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+          double t = (theta >= 0 ? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+          double c = 1.0 / std::sqrt(t * t + 1.0);
+          double s = t * c;
+
+          for (std::size_t k = 0; k < n; k++)
+          {
+            double akp = a[k][p], akq = a[k][q];
+            a[k][p] = c * akp - s * akq;
+            a[k][q] = s * akp + c * akq;
+          }
+          for (std::size_t k = 0; k < n; k++)
+          {
+            double apk = a[p][k], aqk = a[q][k];
+            a[p][k] = c * apk - s * aqk;
+            a[q][k] = s * apk + c * aqk;
+          }
+          for (std::size_t k = 0; k < n; k++)
+          {
+            double vkp = v[k][p], vkq = v[k][q];
+            v[k][p] = c * vkp - s * vkq;
+            v[k][q] = s * vkp + c * vkq;
+          }
+        }
+      }
+    }
+
+    std::vector<std::size_t> order(n);
+    for (std::size_t i = 0; i < n; i++)
+      order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+      [&a](std::size_t i, std::size_t j) { return a[i][i] > a[j][j]; });
+
+    values.resize(n);
+    vectors.assign(n, n);
+    for (std::size_t c = 0; c < n; c++)
+    {
+      values[c] = a[order[c]][order[c]];
+      for (std::size_t r = 0; r < n; r++)
+        vectors[r][c] = v[r][order[c]];
+    }
+  }
+
+  void write_evec(const std::string& path, const pca_result& pca)
+  {
+    // Written aside and renamed, a cached evec is never seen truncated.
+    std::string tmp = path + ".tmp";
+    {
+      std::ofstream out(tmp, std::ios::out);
+      check_fstream_good(tmp, out);
+
+      for (auto& row : pca.eigenvectors)
+      {
+        for (std::size_t c = 0; c < row.size(); c++)
+          out << (c ? "\t" : "") << fmt::format("{:.8f}", row[c]);
+        out << "\n";
+      }
+
+      out.flush();
+      if (!out.good())
+        throw IOError(fmt::format("Unable to write {}.", tmp));
+    }
+    fs::rename(tmp, path);
+  }
+
+} // end of namespace kmdiff
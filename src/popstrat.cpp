@@ -6,14 +6,6 @@
 
 namespace kmdiff {
 
-  void write_parfile(const std::string& path)
-  {
-    std::ofstream out(path, std::ios::out); check_fstream_good(path, out);
-    std::string parent = fs::path(path).parent_path().string();
-    for (auto& [k, v] : parfile_map)
-      out << k << ": " << fmt::format(v, parent) << "\n";
-  }
-
   void write_gwas_info(const std::string& kmfof, const std::string& path,
                        size_t nb_controls, size_t nb_cases, const std::string& gender_file)
   {
@@ -94,43 +86,48 @@ namespace kmdiff {
       out << e << "\n";
   }
 
-  void run_eigenstrat_smartpca(const std::string& popstrat_dir,
-                               const std::string& parfile,
-                               const std::string& log,
-                               bool is_diploid,
-                               std::size_t n)
+  static std::uint32_t eig_hash(const std::string& name)
   {
-    std::string cpath = fs::current_path();
-    fs::current_path(popstrat_dir);
-    std::string smartpca_bin = command_exists(get_binary_dir(), "smartpca");
-    if (is_diploid)
-      exec_external_cmd(smartpca_bin, fmt::format("-p {}", parfile), log);
-    else
-      exec_external_cmd(smartpca_bin, fmt::format("-V -p {}", parfile), log);
-
-    if (!fs::exists(fmt::format(parfile_map.at("evecoutname"), popstrat_dir)))
-      throw EigenStratError("eigenstrat/smartpca failed.");
-
-    std::string evec_bin = command_exists(get_binary_dir(), "evec2pca.perl");
-    std::string pca_file = "gwas_eigenstrat.pca";
-    std::string pcs_file = "pcs.evec";
-    exec_external_cmd(evec_bin, fmt::format("{} {} {} {}",
-                                            n < 10 ? n : 10,
-                                            parfile_map.at("evecoutname"),
-                                            parfile_map.at("indivname"),
-                                            "gwas_eigenstrat.pca").c_str());
-
-    std::ifstream in(pca_file, std::ios::in); check_fstream_good(pca_file, in);
-    std::ofstream out(pcs_file, std::ios::out); check_fstream_good(pcs_file, in);
-    std::string line; std::getline(in, line);
-    int skip = std::stoi(line);
-    for (int i=0; i<skip; i++)
-      std::getline(in, line);
-
-    while (std::getline(in, line))
-      out << line << "\n";
-
-    fs::current_path(cpath);
+    std::uint32_t h = 0;
+    for (char c : name)
+      h = h * 23 + static_cast<std::uint32_t>(c);
+    return h;
+  }
+
+  std::uint32_t eig_hash(const std::vector<std::string>& names)
+  {
+    std::uint32_t h = 0;
+    for (auto& name : names)
+      h = (h * 17) ^ eig_hash(name);
+    return h;
+  }
+
+  std::uint32_t eig_snp_hash(std::size_t nb_snps)
+  {
+    std::uint32_t h = 0;
+    for (std::size_t i = 0; i < nb_snps; i++)
+      h = (h * 17) ^ eig_hash(std::to_string(i));
+    return h;
+  }
+
+  std::uint64_t pca_key(std::uint64_t run,
+                        const std::vector<std::string>& samples,
+                        const std::vector<std::size_t>& control_totals,
+                        const std::vector<std::size_t>& case_totals,
+                        double kmer_pca,
+                        std::size_t seed,
+                        std::size_t ploidy)
+  {
+    std::string key = fmt::format("pca-v2 {:016x} {} {} {} {} ", run, pop_strat_corrector::s_pca_count,
+                                  kmer_pca, seed, ploidy);
+    for (auto& s : samples)
+      key += fmt::format("{} ", s);
+    for (auto& t : control_totals)
+      key += fmt::format("{} ", t);
+    for (auto& t : case_totals)
+      key += fmt::format("{} ", t);
+
+    return static_cast<std::uint64_t>(XXH64(key.data(), key.size(), 0));
   }
 
   pop_strat_corrector::pop_strat_corrector(std::size_t nb_controls, std::size_t nb_cases,
@@ -153,10 +150,31 @@ namespace kmdiff {
   void pop_strat_corrector::load_Z(const std::string& path)
   {
     std::ifstream zin(path, std::ios::in); check_fstream_good(path, zin);
-    m_Z.resize(m_size, vector_t(s_pca_count, 0));
-    for (std::size_t i = 0; i < m_Z.size(); i++)
-      for (std::size_t j = 0; j < s_pca_count; j++)
-        zin >> m_Z[i][j];
+    matrix_t z;
+    for (std::string line; std::getline(zin, line) && z.size() < m_size;)
+    {
+      std::istringstream ss(line);
+      z.emplace_back();
+      for (double v; ss >> v;)
+        z.back().push_back(v);
+
+      if (z.back().size() < m_npc)
+        throw IOError(fmt::format("{}: row {} has {} columns, {} principal components expected.",
+                                  path, z.size(), z.back().size(), m_npc));
+    }
+
+    if (z.size() < m_size)
+      throw IOError(fmt::format("{}: {} rows, {} samples expected.", path, z.size(), m_size));
+
+    set_Z(z);
+  }
+
+  void pop_strat_corrector::set_Z(const matrix_t& z)
+  {
+    m_Z.assign(m_size, vector_t(s_pca_count, 0));
+    for (std::size_t i = 0; i < std::min(m_size, z.size()); i++)
+      for (std::size_t j = 0; j < std::min(s_pca_count, z[i].size()); j++)
+        m_Z[i][j] = z[i][j];
 
     spdlog::debug("\nZ Matrix:\n{}", str_matrix(m_Z));
   }
@@ -272,8 +290,8 @@ namespace kmdiff {
     m_null_feature_count = 1 + m_npc + m_cov_count + 1;
     m_alt_feature_count = 1 + m_null_feature_count;
 
-    m_null_global_features.resize(m_size, vector_t(m_null_feature_count, 0));
-    m_alt_global_features.resize(m_size, vector_t(m_alt_feature_count, 0));
+    m_null_global_features.assign(m_size, m_null_feature_count);
+    m_alt_global_features.assign(m_size, m_alt_feature_count);
 
     for (std::size_t i = 0; i < m_size; i++)
     {
@@ -313,15 +331,44 @@ namespace kmdiff {
     spdlog::debug("\nNULL:\n{}", str_matrix(m_null_global_features));
     spdlog::debug("\nALT:\n{}", str_matrix(m_alt_global_features));
 
+    glm_workspace ws;
+
     #ifdef KMD_USE_IRLS
       auto [model, singular, nan, error, iter] = glm_irls(
-        m_null_global_features, m_Y, s_max_iter);
+        m_null_global_features, m_Y, s_max_iter, ws);
     #else
       auto [model, singular, nan, error, iter] = glm_newton_raphson(
-        m_null_global_features, m_Y, s_learn_rate, s_max_iter);
+        m_null_global_features, m_Y, s_learn_rate, s_max_iter, ws);
     #endif
 
     m_null_model = std::move(model);
+    m_null_log_likelihood = log_likelihood(m_null_model, m_null_global_features, m_Y);
+
+    // The alt models are fitted from the null model, with a null coefficient for the k-mer.
+    m_alt_start = m_null_model;
+    m_alt_start.push_back(0.0);
+
+    if (s_test == PopTest::SCORE)
+      m_score = score_test(m_null_global_features, m_Y, m_null_model);
+  }
+
+  double pop_strat_corrector::lrt_pvalue(double alt_log_likelihood) const
+  {
+    double log_likelihood_ratio = 2.0 * (alt_log_likelihood - m_null_log_likelihood);
+
+    if (std::fabs(log_likelihood_ratio) < s_epsilon ||
+        log_likelihood_ratio < 0.0 ||
+        std::isnan(alt_log_likelihood))
+    {
+      log_likelihood_ratio = 0.0;
+    }
+
+    return alglib::chisquarecdistribution(1, log_likelihood_ratio);
+  }
+
+  double pop_strat_corrector::score_pvalue(const double* col, vector_t& v) const
+  {
+    return alglib::chisquarecdistribution(1, m_score.statistic(col, v));
   }
 
   void pop_strat_corrector::standardize()
@@ -0,0 +1,175 @@
+/*****************************************************************************
+ *   kmdiff
+ *   Authors: T. Lemane
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <sstream>
+
+#include <kmdiff/shard.hpp>
+#include <kmdiff/utils.hpp>
+
+namespace kmdiff {
+
+  static const std::string shard_header = "kmdiff-shard v1";
+
+  void shard_info::write(const std::string& path) const
+  {
+    std::string tmp = path + ".tmp";
+    {
+      std::ofstream out(tmp, std::ios::out); check_fstream_good(tmp, out);
+      out << shard_header << "\n";
+      out << fmt::format("first {}\n", first);
+      out << fmt::format("last {}\n", last);
+      out << fmt::format("nb_partitions {}\n", nb_partitions);
+      out << fmt::format("kmer_size {}\n", kmer_size);
+      out << fmt::format("stage {}\n", stage);
+      out << fmt::format("key {}\n", key);
+      out << fmt::format("threshold {}\n", threshold);
+      out << fmt::format("cutoff {}\n", cutoff);
+      out << fmt::format("sorted {}\n", sorted ? 1 : 0);
+      out << fmt::format("level {}\n", level);
+      out << fmt::format("total_kmers {}\n", total_kmers);
+    }
+    fs::rename(tmp, path);
+  }
+
+  shard_info shard_info::read(const std::string& path)
+  {
+    std::ifstream in(path, std::ios::in); check_fstream_good(path, in);
+    std::string line;
+
+    if (!std::getline(in, line) || line != shard_header)
+      throw IOError(fmt::format("{}: not a kmdiff shard.", path));
+
+    std::map<std::string, std::string> values;
+    while (std::getline(in, line))
+    {
+      std::istringstream ss(line);
+      std::string name, value;
+      if (ss >> name >> value)
+        values[name] = value;
+    }
+
+    auto get = [&](const std::string& name) -> const std::string& {
+      auto it = values.find(name);
+      if (it == values.end())
+        throw IOError(fmt::format("{}: missing '{}'.", path, name));
+      return it->second;
+    };
+
+    shard_info s;
+    s.first = std::stoull(get("first"));
+    s.last = std::stoull(get("last"));
+    s.nb_partitions = std::stoull(get("nb_partitions"));
+    s.kmer_size = std::stoull(get("kmer_size"));
+    s.stage = get("stage");
+    s.key = get("key");
+    s.threshold = std::stod(get("threshold"));
+    s.cutoff = std::stod(get("cutoff"));
+    s.sorted = get("sorted") == "1";
+    s.level = std::stod(get("level"));
+    s.total_kmers = std::stoull(get("total_kmers"));
+    return s;
+  }
+
+  std::pair<std::size_t, std::size_t> parse_partitions(const std::string& range,
+                                                       std::size_t nb_partitions)
+  {
+    std::smatch m;
+    if (!std::regex_match(range, m, std::regex("(\\d+)-(\\d+)")))
+      throw ConfigError(fmt::format("--partitions {}: expected a range a-b.", range));
+
+    std::size_t first = std::stoull(m[1]);
+    std::size_t last = std::stoull(m[2]);
+
+    if (first > last || last >= nb_partitions)
+      throw ConfigError(fmt::format("--partitions {}: not in [0, {}].", range, nb_partitions - 1));
+
+    return {first, last + 1};
+  }
+
+  std::pair<std::size_t, std::size_t> parse_shard(const std::string& shard,
+                                                  std::size_t nb_partitions)
+  {
+    std::smatch m;
+    if (!std::regex_match(shard, m, std::regex("(\\d+)/(\\d+)")))
+      throw ConfigError(fmt::format("--shard {}: expected i/n.", shard));
+
+    std::size_t i = std::stoull(m[1]);
+    std::size_t n = std::stoull(m[2]);
+
+    if (n == 0 || i >= n || n > nb_partitions)
+      throw ConfigError(
+        fmt::format("--shard {}: expected i < n <= {} (number of partitions).", shard, nb_partitions));
+
+    return {i * nb_partitions / n, (i + 1) * nb_partitions / n};
+  }
+
+  std::string shard_dir(const std::string& output_dir)
+  {
+    return fmt::format("{}/shards", output_dir);
+  }
+
+  std::vector<shard_info> load_shards(const std::string& output_dir)
+  {
+    std::string dir = shard_dir(output_dir);
+
+    if (!fs::is_directory(dir))
+      throw FileNotFound(fmt::format("{}: no shards, run kmdiff diff with --shard or --partitions.", dir));
+
+    std::vector<shard_info> shards;
+    for (const auto& entry : fs::directory_iterator(dir))
+    {
+      if (entry.path().extension() == ".shard")
+        shards.push_back(shard_info::read(entry.path().string()));
+    }
+
+    if (shards.empty())
+      throw FileNotFound(fmt::format("{}: no shards, run kmdiff diff with --shard or --partitions.", dir));
+
+    std::sort(shards.begin(), shards.end(),
+              [](const shard_info& a, const shard_info& b) { return a.first < b.first; });
+
+    const shard_info& s = shards.front();
+    std::size_t next = 0;
+
+    for (const auto& shard : shards)
+    {
+      if (shard.nb_partitions != s.nb_partitions || shard.kmer_size != s.kmer_size ||
+          shard.stage != s.stage || shard.key != s.key || shard.threshold != s.threshold ||
+          shard.cutoff != s.cutoff || shard.sorted != s.sorted)
+        throw ConfigError(
+          fmt::format("Shards {} and {} come from different analyses.", s.name(), shard.name()));
+
+      if (shard.first < next)
+        throw ConfigError(fmt::format("Shard {} overlaps another shard.", shard.name()));
+      if (shard.first > next)
+        throw ConfigError(fmt::format("Partitions {}-{} are missing.", next, shard.first - 1));
+
+      next = shard.last;
+    }
+
+    if (next != s.nb_partitions)
+      throw ConfigError(fmt::format("Partitions {}-{} are missing.", next, s.nb_partitions - 1));
+
+    return shards;
+  }
+
+} // end of namespace kmdiff
@@ -16,23 +16,59 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  *****************************************************************************/
 
+#ifdef __linux__
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+
 #include <kmdiff/threadpool.hpp>
 
 namespace kmdiff {
 
-  ThreadPool::ThreadPool(size_type threads)
+  ThreadPool::ThreadPool(size_type threads, bool pin)
   {
     if (threads < _n) _n = threads;
+    if (_n < 1) _n = 1;
+
+    for (size_t i = 0; i < _n; i++)
+      _queues.push_back(std::make_unique<worker_queue>());
+
+  #ifdef __linux__
+    // Only the cpus allowed to the process (taskset, cgroups, slurm...) are used.
+    std::vector<int> cpus;
+    if (pin)
+    {
+      cpu_set_t allowed;
+      CPU_ZERO(&allowed);
+      if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed) == 0)
+      {
+        for (int c = 0; c < CPU_SETSIZE; c++)
+          if (CPU_ISSET(c, &allowed))
+            cpus.push_back(c);
+      }
+    }
+  #endif
+
     for (size_t i = 0; i < _n; i++)
     {
       _pool.push_back(std::thread(&ThreadPool::worker, this, i));
+
+    #ifdef __linux__
+      if (!cpus.empty())
+      {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(cpus[i % cpus.size()], &cpuset);
+        pthread_setaffinity_np(_pool.back().native_handle(), sizeof(cpu_set_t), &cpuset);
+      }
+    #endif
     }
   }
 
   ThreadPool::~ThreadPool()
   {
     {
-      std::unique_lock<std::mutex> lock(_queue_mutex);
+      std::unique_lock<std::mutex> lock(_mutex);
       _stop = true;
     }
     _condition.notify_all();
@@ -43,11 +79,18 @@ namespace kmdiff {
   void ThreadPool::join_all()
   {
     {
-      std::unique_lock<std::mutex> lock(_queue_mutex);
+      std::unique_lock<std::mutex> lock(_mutex);
       _stop = true;
     }
     _condition.notify_all();
-    for (std::thread& t : _pool) t.join();
+    for (std::thread& t : _pool)
+      if (t.joinable()) t.join();
+
+    if (_ep != nullptr)
+    {
+      auto ep = _ep; _ep = nullptr;
+      std::rethrow_exception(ep);
+    }
   }
 
   void ThreadPool::join(int i)
@@ -55,21 +98,93 @@ namespace kmdiff {
     if (_pool[i].joinable()) _pool[i].join();
   }
 
+  bool ThreadPool::pop(std::size_t i, task_t& task)
+  {
+    std::unique_lock<std::mutex> lock(_queues[i]->mutex);
+    for (std::size_t l = s_levels; l-- > 0;)
+    {
+      auto& q = _queues[i]->tasks[l];
+      if (!q.empty())
+      {
+        task = std::move(q.back());
+        q.pop_back();
+        _queued--;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ThreadPool::steal(std::size_t i, task_t& task)
+  {
+    for (std::size_t l = s_levels; l-- > 0;)
+    {
+      for (std::size_t j = 1; j < _n; j++)
+      {
+        auto& victim = *_queues[(i + j) % _n];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks[l].empty())
+          continue;
+
+        task = std::move(victim.tasks[l].front());
+        victim.tasks[l].pop_front();
+        _queued--;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void ThreadPool::run(task_t& task, int i)
+  {
+    try
+    {
+      task(i);
+    }
+    catch (...)
+    {
+      std::unique_lock<std::mutex> lock(_ep_mutex);
+      if (_ep == nullptr) _ep = std::current_exception();
+    }
+
+    if (--_pending == 0)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.notify_all();
+    }
+  }
+
+  void ThreadPool::wait_until(const std::function<bool()>& done)
+  {
+    std::size_t i = is_worker() ? s_worker_id : 0;
+    while (!done())
+    {
+      task_t task;
+      if ((is_worker() && pop(i, task)) || steal(i, task) || pop(i, task))
+        run(task, i);
+      else
+        std::this_thread::yield();
+    }
+  }
+
   void ThreadPool::worker(int i)
   {
+    s_pool = this;
+    s_worker_id = i;
+
     while (true)
     {
-      std::function<void(int)> task;
+      task_t task;
+      if (pop(i, task) || steal(i, task))
       {
-        std::unique_lock<std::mutex> lock(this->_queue_mutex);
-        this->_condition.wait(lock, [this] { return this->_stop || !this->_queue.empty(); });
-        if (this->_stop && this->_queue.empty()) return;
-        task = std::move(this->_queue.front());
-        this->_queue.pop();
+        run(task, i);
+        continue;
       }
-      task(i);
+
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.wait(lock, [this] { return _queued > 0 || (_stop && _pending == 0); });
+      if (_stop && _pending == 0) return;
     }
   }
 
 } // end of namespace kmdiff
-
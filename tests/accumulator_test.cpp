@@ -16,6 +16,8 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  *****************************************************************************/
 
+#include <chrono>
+
 #include <gtest/gtest.h>
 #define private public
 #include <kmdiff/kmer.hpp>
@@ -80,6 +82,75 @@ TEST(accumulator, FileAccumulator)
   }
 }
 
+TEST(accumulator, FileAccumulatorAbort)
+{
+  acc_t<int> file = std::make_shared<FileAccumulator<int>>("./tests_tmp/abort.lz4");
+  acc_t<int> acc = std::make_shared<SortedAccumulator<int>>(file, std::less<int>());
+  for (int i = 0; i < 10; i++)
+    acc->push(std::move(i));
+
+  acc->abort();
+
+  EXPECT_FALSE(fs::exists("./tests_tmp/abort.lz4"));
+  EXPECT_FALSE(fs::exists("./tests_tmp/abort.lz4.tmp"));
+}
+
+TEST(accumulator, SortedAccumulatorRuns)
+{
+  using elem_t = std::pair<int, int>;
+
+  acc_t<elem_t> file = std::make_shared<FileAccumulator<elem_t>>("./tests_tmp/runs.lz4");
+  acc_t<elem_t> acc = std::make_shared<SortedAccumulator<elem_t>>(file,
+    [](const elem_t& a, const elem_t& b) { return a.first < b.first; }, "./tests_tmp/runs", 0, 7);
+
+  // Pushed in the order of the second member, which the sort keeps among equal keys.
+  for (int i = 0; i < 100; i++)
+    acc->push({(i * 37) % 10, i});
+
+  EXPECT_TRUE(fs::exists("./tests_tmp/runs.run0"));
+  EXPECT_EQ(acc->size(), 100);
+
+  acc->finish();
+
+  EXPECT_FALSE(fs::exists("./tests_tmp/runs.run0"));
+
+  std::vector<elem_t> v;
+  while (const std::optional<elem_t>& o = acc->get())
+    v.push_back(*o);
+
+  ASSERT_EQ(v.size(), 100);
+  for (std::size_t i = 1; i < v.size(); i++)
+  {
+    EXPECT_LE(v[i - 1].first, v[i].first);
+    if (v[i - 1].first == v[i].first)
+      EXPECT_LT(v[i - 1].second, v[i].second);
+  }
+}
+
+TEST(accumulator, SortedPrefixAccumulator)
+{
+  acc_t<int> file = std::make_shared<FileAccumulator<int>>("./tests_tmp/sorted.lz4");
+  acc_t<int> sorted = std::make_shared<SortedAccumulator<int>>(file, std::less<int>());
+  acc_t<int> acc = std::make_shared<PrefixAccumulator<int>>(sorted, [](int e) { return e < 5; });
+
+  std::vector<int> v {7, 3, 9, 0, 4, 8, 1, 6, 2, 5};
+  for (auto e : v)
+    acc->push(std::move(e));
+
+  acc->finish();
+
+  EXPECT_EQ(acc->size(), v.size());
+
+  int i = 0;
+  while (const std::optional<int>&o = acc->get())
+  {
+    EXPECT_EQ(o.value(), i);
+    i++;
+  }
+  EXPECT_EQ(i, 5);
+  EXPECT_FALSE(acc->get());
+}
+
 TEST(accumulator, KmerSignVec)
 {
   using kmer_sign_t = KmerSign<32>;
@@ -106,3 +177,114 @@ TEST(accumulator, KmerSignVec)
   }
 }
 
+
+TEST(accumulator, PartitionManifest)
+{
+  std::vector<std::string> parts {"./tests_tmp/m_p0", "./tests_tmp/m_p1"};
+
+  std::vector<std::uint64_t> checksums;
+  for (auto& path : parts)
+  {
+    acc_t<int> acc = std::make_shared<FileAccumulator<int>>(path);
+    for (int i = 0; i < 10; i++)
+      acc->push(std::move(i));
+    acc->finish();
+    checksums.push_back(acc->checksum());
+    EXPECT_EQ(acc->checksum(), file_checksum(path));
+  }
+
+  {
+    partition_manifest manifest("./tests_tmp/m.manifest", "key", parts);
+    EXPECT_FALSE(manifest.done(0));
+    manifest.commit(0, {10, 100, 4, 6, checksums[0]});
+    manifest.commit(1, {10, 50, 5, 5, 0});
+    EXPECT_TRUE(manifest.complete());
+    EXPECT_EQ(manifest.get(1)->checksum, checksums[1]);
+  }
+
+  {
+    partition_manifest manifest("./tests_tmp/m.manifest", "key", parts);
+    EXPECT_TRUE(manifest.complete());
+    EXPECT_EQ(manifest.get(0)->controls, 4);
+    EXPECT_EQ(manifest.total(), 150);
+  }
+
+  // A touched file is verified on its checksum.
+  fs::last_write_time(parts[0], fs::last_write_time(parts[0]) - std::chrono::hours(1));
+
+  {
+    partition_manifest manifest("./tests_tmp/m.manifest", "key", parts);
+    EXPECT_TRUE(manifest.complete());
+  }
+
+  // Same size, other content.
+  {
+    std::fstream io(parts[0], std::ios::in | std::ios::out | std::ios::binary);
+    io.seekp(-1, std::ios::end);
+    io.put('x');
+  }
+  fs::last_write_time(parts[0], fs::last_write_time(parts[0]) - std::chrono::hours(1));
+
+  {
+    partition_manifest manifest("./tests_tmp/m.manifest", "key", parts);
+    EXPECT_FALSE(manifest.done(0));
+    EXPECT_TRUE(manifest.done(1));
+  }
+
+  {
+    std::ofstream out(parts[1], std::ios::app);
+    out << "x";
+  }
+
+  {
+    partition_manifest manifest("./tests_tmp/m.manifest", "key", parts);
+    EXPECT_FALSE(manifest.done(0));
+    EXPECT_FALSE(manifest.done(1));
+  }
+
+  {
+    partition_manifest manifest("./tests_tmp/m.manifest", "other", parts);
+    EXPECT_FALSE(manifest.done(0));
+    EXPECT_FALSE(manifest.get(0));
+  }
+}
+
+TEST(accumulator, ManifestLevel)
+{
+  std::vector<std::string> parts {"./tests_tmp/l_p0", "./tests_tmp/l_p1"};
+
+  for (auto& path : parts)
+  {
+    acc_t<int> acc = std::make_shared<FileAccumulator<int>>(path);
+    acc->push(1);
+    acc->finish();
+  }
+
+  {
+    partition_manifest manifest("./tests_tmp/l.manifest", "key", parts);
+    manifest.commit(0, {1, 1, 1, 0, 0, 0.5, true});
+    manifest.commit(1, {1, 1, 1, 0, 0, 1e-5, false});
+  }
+
+  partition_manifest manifest("./tests_tmp/l.manifest", "key", parts);
+  EXPECT_EQ(manifest.get(0)->level, 0.5);
+  EXPECT_TRUE(manifest.get(0)->sorted);
+  EXPECT_EQ(manifest.get(1)->level, 1e-5);
+  EXPECT_FALSE(manifest.get(1)->sorted);
+
+  manifest.keep_if([](const partition_manifest::entry& e) { return e.sorted && e.level >= 0.1; });
+  EXPECT_TRUE(manifest.done(0));
+  EXPECT_FALSE(manifest.done(1));
+}
+
+TEST(accumulator, StageKey)
+{
+  stage_key a("stage"); a.add(1).add(0.05).add_file("");
+  stage_key b("stage"); b.add(1).add(0.05).add_file("");
+  stage_key c("stage"); c.add(1).add(0.01).add_file("");
+  stage_key d("stage"); d.add(10).add(0.5).add_file("");
+
+  EXPECT_EQ(a.value(), b.value());
+  EXPECT_NE(a.value(), c.value());
+  EXPECT_NE(a.value(), d.value());
+}
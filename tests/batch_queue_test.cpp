@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <numeric>
+#include <kmdiff/batch_queue.hpp>
+
+using namespace kmdiff;
+
+TEST(batch_queue, mpmc)
+{
+  const std::size_t nb_producers = 8;
+  const std::size_t n = 100000;
+
+  BatchQueue<std::size_t> queue(1 << 12, 64, nb_producers);
+
+  std::vector<std::thread> producers;
+  for (std::size_t p = 0; p < nb_producers; p++)
+  {
+    producers.emplace_back([&queue, p, n]() {
+      BatchProducer<std::size_t> producer(queue);
+      for (std::size_t i = 0; i < n; i++)
+        producer.push(p * n + i);
+      producer.finish();
+    });
+  }
+
+  std::vector<std::size_t> sums(2, 0);
+  std::vector<std::size_t> counts(2, 0);
+  std::vector<std::thread> consumers;
+  for (std::size_t c = 0; c < 2; c++)
+  {
+    consumers.emplace_back([&queue, &sums, &counts, c]() {
+      BatchQueue<std::size_t>::batch_type batch;
+      while (queue.pop(batch))
+      {
+        for (auto& e : batch)
+        {
+          sums[c] += e;
+          counts[c]++;
+        }
+      }
+    });
+  }
+
+  for (auto& t : producers) t.join();
+  for (auto& t : consumers) t.join();
+
+  std::size_t total = nb_producers * n;
+  EXPECT_EQ(counts[0] + counts[1], total);
+  EXPECT_EQ(sums[0] + sums[1], total * (total - 1) / 2);
+}
@@ -0,0 +1,51 @@
+#include <fstream>
+#include <iterator>
+
+#include <gtest/gtest.h>
+#include <zlib.h>
+#include <kmdiff/utils.hpp>
+#include <kmdiff/bgzf.hpp>
+
+using namespace kmdiff;
+
+TEST(bgzf, write)
+{
+  std::string data;
+  for (size_t i=0; i<20000; i++)
+    data += ">" + std::to_string(i) + "\n" + random_dna_seq(31) + "\n";
+
+  {
+    BgzfWriter out("./tests_tmp/test.fasta.gz", 4);
+    for (size_t i=0; i<data.size(); i+=1000)
+      out.write(data.substr(i, 1000));
+    out.close();
+  }
+
+  gzFile in = gzopen("./tests_tmp/test.fasta.gz", "rb");
+  ASSERT_TRUE(in != nullptr);
+  std::string res;
+  char buffer[8192];
+  int n = 0;
+  while ((n = gzread(in, buffer, sizeof(buffer))) > 0)
+    res.append(buffer, n);
+  gzclose(in);
+
+  EXPECT_EQ(res, data);
+}
+
+TEST(bgzf, not_closed)
+{
+  const std::string path = "./tests_tmp/test_not_closed.fasta.gz";
+  {
+    BgzfWriter out(path, 2);
+    out.write(std::string(BgzfWriter::block_size + 100, 'A'));
+  }
+
+  // No EOF marker: the file reads as truncated.
+  const std::string eof("\x1f\x8b\x08\x04\x00\x00\x00\x00\x00\xff\x06\x00\x42\x43"
+                        "\x02\x00\x1b\x00\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00", 28);
+  std::ifstream in(path, std::ios::binary);
+  std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  EXPECT_TRUE(content.size() < eof.size() ||
+              content.compare(content.size() - eof.size(), eof.size(), eof) != 0);
+}
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <random>
+
 #include <gtest/gtest.h>
 #include <kmdiff/utils.hpp>
 #include <kmdiff/kmer.hpp>
@@ -23,10 +26,116 @@ TEST(kff, read_write)
 
   {
     KffReader f("./tests_tmp/test.kff", kmer_size);
-    int i = 0;
+    std::vector<std::string> rs;
     while (std::optional<km::Kmer<32>> k = f.read<32>())
+      rs.push_back((*k).to_string());
+    std::sort(vs.begin(), vs.end());
+    std::sort(rs.begin(), rs.end());
+    EXPECT_EQ(rs, vs);
+  }
+}
+
+TEST(kff, read_write_blocks)
+{
+  size_t kmer_size = 45;
+  std::string seq = random_dna_seq(500);
+  std::vector<std::string> vs;
+  for (size_t i=0; i+kmer_size<=seq.size(); i++)
+    vs.push_back(seq.substr(i, kmer_size));
+  for (size_t i=0; i<10; i++)
+    vs.push_back(random_dna_seq(kmer_size));
+
+  // k-mers come in sorted order from the merge, not in sequence order
+  std::shuffle(vs.begin(), vs.end(), std::mt19937(42));
+
+  for (size_t max : {64, 1})
+  {
+    KffWriter f(fmt::format("./tests_tmp/test_blocks_{}.kff", max), kmer_size, max);
+    for (auto& s: vs)
     {
-      EXPECT_EQ((*k).to_string(), vs[i]); i++;
+      km::Kmer<64> k(s);
+      f.write(k);
     }
+    f.close();
   }
+
+  {
+    KffReader f("./tests_tmp/test_blocks_64.kff", kmer_size);
+    std::vector<std::string> rs;
+    while (std::optional<km::Kmer<64>> k = f.read<64>())
+      rs.push_back((*k).to_string());
+    std::sort(vs.begin(), vs.end());
+    std::sort(rs.begin(), rs.end());
+    EXPECT_EQ(rs, vs);
+  }
+
+  // overlapping k-mers are packed in super-k-mers, one k-mer per block otherwise
+  EXPECT_LT(fs::file_size("./tests_tmp/test_blocks_64.kff") * 3,
+            fs::file_size("./tests_tmp/test_blocks_1.kff"));
+}
+
+TEST(kff, read_write_data)
+{
+  size_t kmer_size = 31;
+  std::vector<KmerSign<32>> vs;
+  for (size_t i=0; i<100; i++)
+  {
+    km::Kmer<32> k(random_dna_seq(kmer_size));
+    vs.emplace_back();
+    vs.back().m_kmer = k;
+    vs.back().m_pvalue = std::pow(10.0, -static_cast<double>(i * 3));
+    vs.back().m_sign = i % 2 ? Significance::CASE : Significance::CONTROL;
+    vs.back().m_mean_control = i;
+    vs.back().m_mean_case = i * 0.5;
+  }
+  {
+    KffWriter f("./tests_tmp/test_data.kff", kmer_size, 255, true);
+    for (auto& ks: vs)
+      f.write(ks);
+    f.close();
+  }
+
+  {
+    std::sort(vs.begin(), vs.end(), [](const auto& a, const auto& b) {
+      return a.to_string() < b.to_string();
+    });
+    std::vector<KmerSign<32>> rs;
+    KffReader f("./tests_tmp/test_data.kff", kmer_size);
+    while (std::optional<KmerSign<32>> ks = f.read_sign<32>())
+      rs.push_back(*ks);
+    std::sort(rs.begin(), rs.end(), [](const auto& a, const auto& b) {
+      return a.to_string() < b.to_string();
+    });
+
+    ASSERT_EQ(rs.size(), vs.size());
+    for (size_t i = 0; i < rs.size(); i++)
+    {
+      EXPECT_EQ(rs[i].to_string(), vs[i].to_string());
+      EXPECT_NEAR(std::log10(rs[i].m_pvalue), std::log10(vs[i].m_pvalue), 1e-3);
+      EXPECT_EQ(rs[i].m_sign, vs[i].m_sign);
+      EXPECT_FLOAT_EQ(rs[i].m_mean_control, vs[i].m_mean_control);
+      EXPECT_FLOAT_EQ(rs[i].m_mean_case, vs[i].m_mean_case);
+    }
+  }
+}
+
+TEST(kff, payload_layout)
+{
+  KmerSign<32> ks;
+  ks.m_pvalue = 1.0;
+  ks.m_mean_control = 1.0;
+  ks.m_mean_case = -2.0;
+  ks.m_sign = Significance::CASE;
+
+  std::uint8_t buf[kff_payload::size];
+  kff_payload::encode(ks, buf);
+
+  std::uint8_t expected[kff_payload::size] = {
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f,
+    0x00, 0x00, 0x00, 0xc0,
+    static_cast<std::uint8_t>(Significance::CASE)
+  };
+  for (std::size_t i = 0; i < kff_payload::size; i++)
+    EXPECT_EQ(buf[i], expected[i]);
 }
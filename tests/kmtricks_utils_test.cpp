@@ -1,56 +1,173 @@
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
 #include <gtest/gtest.h>
 #include <fmt/format.h>
+#define private public
 #include <kmdiff/kmtricks_utils.hpp>
 #include <kmdiff/exceptions.hpp>
 
 using namespace kmdiff;
 
-const std::string kmtricks_dir = "./data_test/kmtricks-dir";
-const std::string kmtricks_dir_bad = "./data_test/kmtricks-dir-bad";
+const std::string kmtricks_dir = "./data_test/km_out_dir";
+
+static std::string read_file(const std::string& path)
+{
+  std::ifstream in(path);
+  std::stringstream ss; ss << in.rdbuf();
+  return ss.str();
+}
+
+// A copy of the test run, with its samples renamed to <id><suffix> and a repartition.
+static std::string make_run(const std::string& name, const std::string& suffix,
+                            const std::string& repart = "repart")
+{
+  std::string dir = fmt::format("./tests_tmp/{}", name);
+  fs::remove_all(dir);
+  fs::copy(kmtricks_dir, dir, fs::copy_options::recursive);
+
+  fs::create_directories(dir + "/repartition_gatb");
+  std::ofstream(dir + "/repartition_gatb/repartition.minimRepart") << repart;
+
+  if (suffix.empty())
+    return dir;
+
+  for (auto id : {"Control1", "Case1"})
+  {
+    std::string nid = id + suffix;
+    fs::rename(fmt::format("{}/histograms/{}.hist", dir, id),
+               fmt::format("{}/histograms/{}.hist", dir, nid));
+    for (auto& entry : fs::directory_iterator(dir + "/counts"))
+    {
+      fs::rename(fmt::format("{}/{}.kmer.lz4", entry.path().string(), id),
+                 fmt::format("{}/{}.kmer.lz4", entry.path().string(), nid));
+    }
+  }
+
+  std::ofstream(dir + "/kmtricks.fof")
+    << fmt::format("Control1{0} : ./fasta/control1.fasta\nCase1{0} : ./fasta/case1.fasta\n", suffix);
+
+  return dir;
+}
 
 TEST(kmtricks_utils, config)
 {
   kmtricks_config_t config = get_kmtricks_config(kmtricks_dir);
   EXPECT_EQ(config.kmer_size, 20);
   EXPECT_EQ(config.nb_partitions, 4);
+}
+
+TEST(kmtricks_utils, fof_concat)
+{
+  std::string a = make_run("fof_a", "");
+  std::string b = make_run("fof_b", "_b");
+
+  EXPECT_EQ(fof_path({a}, "./tests_tmp"), a + "/kmtricks.fof");
+
+  std::string path = fof_path({a, b}, "./tests_tmp");
+  EXPECT_EQ(path, "./tests_tmp/kmtricks.fof");
+  EXPECT_EQ(read_file(path),
+            "Control1 : ./fasta/control1.fasta\nCase1 : ./fasta/case1.fasta\n"
+            "Control1_b : ./fasta/control1.fasta\nCase1_b : ./fasta/case1.fasta\n");
+
+  // Not rewritten when unchanged.
+  auto time = fs::last_write_time(path) - std::chrono::hours(1);
+  fs::last_write_time(path, time);
+  fof_path({a, b}, "./tests_tmp");
+  EXPECT_EQ(fs::last_write_time(path), time);
+
+  std::string options = options_path({a, b}, "./tests_tmp");
+  std::string line = read_file(a + "/options.txt");
+  EXPECT_EQ(read_file(options), line + "\n" + line + "\n");
+}
+
+TEST(kmtricks_utils, duplicate_ids)
+{
+  std::string a = make_run("dup_a", "");
+  std::string b = make_run("dup_b", "");
+
+  EXPECT_THROW(fof_path({a, b}, "./tests_tmp"), ConfigError);
+}
+
+TEST(kmtricks_utils, repartition)
+{
+  std::string a = make_run("rep_a", "");
+  std::string b = make_run("rep_b", "_b");
+  std::string c = make_run("rep_c", "_c", "other");
+
+  kmtricks_config_t config = get_kmtricks_config(std::vector<std::string>{a, b});
+  EXPECT_EQ(config.kmer_size, 20);
+  EXPECT_EQ(config.nb_partitions, 4);
 
-  EXPECT_THROW(get_kmtricks_config("./dummy/"), KmtricksFileNotFound);
-  EXPECT_THROW(get_kmtricks_config(kmtricks_dir_bad), ConfigError);
+  EXPECT_THROW(get_kmtricks_config(std::vector<std::string>{a, c}), ConfigError);
 }
 
-TEST(kmtricks_utils, fofs)
+TEST(kmtricks_utils, run_manifest)
 {
-  std::vector<std::string> fofs = get_fofs(kmtricks_dir);
-  std::string tmp = "{}/storage/kmers_partitions/partition_{}/{}";
-  EXPECT_EQ(fofs[0], fmt::format(tmp, kmtricks_dir, 0, "partition0.fof"));
-  EXPECT_EQ(fofs[1], fmt::format(tmp, kmtricks_dir, 1, "partition1.fof"));
-  EXPECT_EQ(fofs[2], fmt::format(tmp, kmtricks_dir, 2, "partition2.fof"));
-  EXPECT_EQ(fofs[3], fmt::format(tmp, kmtricks_dir, 3, "partition3.fof"));
+  std::string dir = make_run("man", "");
+  std::string path = dir + "/kmdiff-run.manifest";
+  std::uint64_t key = run_key(dir);
+
+  auto built = run_manifest::get(dir);
+  ASSERT_TRUE(fs::exists(path));
 
-  int i = 0;
-  for (auto& e : fofs)
+  run_manifest loaded;
+  ASSERT_TRUE(loaded.load(path, key));
+  EXPECT_EQ(loaded.config().kmer_size, built->config().kmer_size);
+  EXPECT_EQ(loaded.config().nb_partitions, built->config().nb_partitions);
+  EXPECT_EQ(loaded.m_ids, built->m_ids);
+  EXPECT_EQ(loaded.m_ab_mins, built->m_ab_mins);
+  EXPECT_EQ(loaded.m_totals, built->m_totals);
+  EXPECT_EQ(loaded.partitions(), built->partitions());
+  EXPECT_EQ(loaded.sizes(), built->sizes());
+  ASSERT_EQ(loaded.m_stats.size(), built->m_stats.size());
+  for (std::size_t p = 0; p < loaded.m_stats.size(); p++)
   {
-    std::string line;
-    std::ifstream in(e);
-    std::getline(in, line);
-    EXPECT_EQ(line, fmt::format(tmp, kmtricks_dir, i, "D1.kmer.lz4"));
-    std::getline(in, line);
-    EXPECT_EQ(line, fmt::format(tmp, kmtricks_dir, i, "D2.kmer.lz4"));
-    i++;
+    ASSERT_EQ(loaded.m_stats[p].size(), built->m_stats[p].size());
+    for (std::size_t i = 0; i < loaded.m_stats[p].size(); i++)
+    {
+      EXPECT_EQ(loaded.m_stats[p][i].size, built->m_stats[p][i].size);
+      EXPECT_EQ(loaded.m_stats[p][i].mtime, built->m_stats[p][i].mtime);
+    }
   }
+
+  run_manifest other;
+  EXPECT_FALSE(other.load(path, key + 1));
+
+  // A corrupt length, the one of the first sample id, falls back to a rebuild.
+  {
+    std::fstream io(path, std::ios::in | std::ios::out | std::ios::binary);
+    io.seekp(sizeof(int) + 5 * sizeof(std::uint64_t));
+    std::uint64_t length = ~0ULL;
+    io.write(reinterpret_cast<const char*>(&length), sizeof(length));
+  }
+
+  run_manifest corrupt;
+  EXPECT_NO_THROW(EXPECT_FALSE(corrupt.load(path, key)));
+  EXPECT_EQ(corrupt.nb_samples(), 0);
 }
 
-TEST(kmtricks_utils, total)
+TEST(kmtricks_utils, run_key)
 {
-  std::tuple<std::vector<size_t>, std::vector<size_t>> t = get_total_kmer(
-    kmtricks_dir, 1, 1
-  );
+  std::string dir = make_run("key", "");
+  auto manifest = run_manifest::get(dir);
+  std::uint64_t key = run_key(dir);
+  EXPECT_EQ(manifest->key(), key);
+  EXPECT_EQ(run_key(std::vector<std::string>{dir}), key);
+  EXPECT_NO_THROW(manifest->check(0));
 
-  EXPECT_EQ(std::get<0>(t).size(), 1);
-  EXPECT_EQ(std::get<1>(t).size(), 1);
+  // A count file rewritten in place, its partition directory is left as it was. The key does not
+  // see it, the merge of the partition does.
+  std::string part = dir + "/counts/partition_0";
+  auto time = fs::last_write_time(part);
+  std::ofstream(part + "/Control1.kmer.lz4", std::ios::app) << "x";
+  fs::last_write_time(part, time);
 
-  EXPECT_EQ(std::get<0>(t)[0], 160);
-  EXPECT_EQ(std::get<1>(t)[0], 160);
+  EXPECT_EQ(run_key(dir), key);
+  EXPECT_NO_THROW(manifest->check(1));
+  EXPECT_THROW(manifest->check(0), IOError);
 
-  EXPECT_THROW(get_total_kmer(kmtricks_dir_bad, 1, 1), KmtricksFileNotFound);
-}
\ No newline at end of file
+  // The partition directory is touched, the next run indexes the run again.
+  EXPECT_NE(run_key(dir), key);
+}
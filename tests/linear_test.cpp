@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <kmdiff/linear_model.hpp>
 #include <cmath>
+#include <random>
 
 using namespace kmdiff;
 
@@ -149,3 +150,160 @@ TEST(linear, lu_decomposition)
     }
   }
 }
+
+TEST(linear, log_likelihood)
+{
+  matrix_t x = {
+    {1, 0.5},
+    {1, -1.2},
+    {1, 2.0},
+  };
+  vector_t y = {1, 0, 1};
+  vector_t model = {0.3, 1.1};
+
+  double l = 1.0;
+  for (size_t i = 0; i < nrows(x); i++)
+  {
+    double p = predict(model, x[i]);
+    l *= y[i] == 1 ? p : 1.0 - p;
+  }
+  EXPECT_TRUE(is_equal_d(std::log(l), log_likelihood(model, x, y), 1e-12));
+
+  EXPECT_TRUE(is_equal_d(log_sigmoid(-800), -800, 1e-12));
+  EXPECT_TRUE(std::isfinite(log_likelihood({0, 100}, {{1, 10}}, {0})));
+}
+
+TEST(linear, dense_kernels)
+{
+  matrix_t m = {
+    {1, 2, 1},
+    {1, 1, 6},
+    {1, 0, 1},
+    {1, 0, 2},
+  };
+  matrix_t m2 = {
+    {1, 0},
+    {2, 1},
+    {0, 3},
+  };
+  vector_t w = {0.5, 1, 0, 2};
+
+  dense_matrix d(m);
+  EXPECT_TRUE(is_equal_m(d.to_matrix(), m));
+
+  dense_matrix res;
+  multiply(d, dense_matrix(m2), res);
+  EXPECT_TRUE(is_equal_m(res.to_matrix(), multiply(m, m2)));
+
+  matrix_t sm = m;
+  for (size_t i = 0; i < nrows(sm); i++)
+    for (auto& e : sm[i])
+      e *= w[i];
+
+  xtwx(d, w.data(), res);
+  EXPECT_TRUE(is_equal_m(res.to_matrix(), multiply(transpose(m), sm)));
+
+  vector_t v(ncols(m));
+  xtv(d, w.data(), v.data());
+  EXPECT_TRUE(is_equal_v(v, {3.5, 2, 10.5}));
+}
+
+TEST(linear, cholesky_solve)
+{
+  dense_matrix h(matrix_t{{4, 2}, {2, 3}});
+  vector_t b = {2, 1};
+  auto [singular, nan] = cholesky_solve(h, b.data());
+  EXPECT_FALSE(singular || nan);
+  EXPECT_TRUE(is_equal_d(b[0], 0.5, 1e-12));
+  EXPECT_TRUE(is_equal_d(b[1], 0.0, 1e-12));
+
+  dense_matrix s(matrix_t{{1, 1}, {1, 1}});
+  auto [singular_, nan_] = cholesky_solve(s, b.data());
+  EXPECT_TRUE(singular_);
+}
+
+TEST(linear, batch_irls)
+{
+  std::mt19937 gen(42);
+  std::normal_distribution<double> dist;
+
+  const size_t n = 60, p = 4, lanes = 9;
+  dense_matrix shared(n, p - 1);
+  vector_t y(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    shared[i][0] = 1;
+    for (size_t j = 1; j < p - 1; j++)
+      shared[i][j] = dist(gen);
+    y[i] = shared[i][1] + dist(gen) > 0;
+  }
+
+  dense_matrix cols(lanes, n);
+  for (size_t l = 0; l < lanes; l++)
+    for (size_t i = 0; i < n; i++)
+      cols[l][i] = l % 4 ? dist(gen) + l * y[i] / 4.0 : 0.0;
+
+  batch_irls fitter(shared, y);
+  std::vector<glm_fit_t> models;
+  vector_t ll;
+  fitter.fit(cols, 100, models, {0.1, 0.2, 0.3, 0.0});
+  fitter.log_likelihoods(models, ll);
+
+  glm_workspace ws;
+  dense_matrix x(n, p);
+  for (size_t l = 0; l < lanes; l++)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      for (size_t j = 0; j < p - 1; j++)
+        x[i][j] = shared[i][j];
+      x[i][p - 1] = cols[l][i];
+    }
+    auto [model, singular, nan, error, iter] = glm_irls(x, y, 100, ws, {0.1, 0.2, 0.3, 0.0});
+    auto& [model_, singular_, nan_, error_, iter_] = models[l];
+
+    EXPECT_EQ(singular, singular_);
+    EXPECT_EQ(nan, nan_);
+    EXPECT_EQ(iter, iter_);
+    EXPECT_TRUE(is_equal_d(error, error_, 1e-12));
+    for (size_t j = 0; j < p; j++)
+      EXPECT_TRUE(is_equal_d(model[j], model_[j], 1e-9));
+    EXPECT_TRUE(is_equal_d(log_likelihood(model, x, y), ll[l], 1e-9));
+  }
+}
+
+TEST(linear, score_test)
+{
+  std::mt19937 gen(7);
+  std::normal_distribution<double> dist;
+
+  const size_t n = 2000;
+  dense_matrix x0(n, 2);
+  dense_matrix x1(n, 3);
+  vector_t y(n);
+  vector_t c(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    x0[i][0] = x1[i][0] = 1;
+    x0[i][1] = x1[i][1] = dist(gen);
+    c[i] = x1[i][2] = dist(gen);
+    y[i] = x0[i][1] + 0.1 * c[i] + dist(gen) > 0;
+  }
+
+  glm_workspace ws;
+  auto [null_model, s0, n0, e0, i0] = glm_irls(x0, y, 100, ws);
+  auto [alt_model, s1, n1, e1, i1] = glm_irls(x1, y, 100, ws);
+  double lrt = 2.0 * (log_likelihood(alt_model, x1, y) - log_likelihood(null_model, x0, y));
+
+  score_test st(x0, y, null_model);
+  vector_t v;
+  double score = st.statistic(c.data(), v);
+
+  // Asymptotically equivalent to the LRT.
+  EXPECT_GT(score, 0.0);
+  EXPECT_LT(std::fabs(score - lrt) / lrt, 0.05);
+
+  // A null column is not testable.
+  vector_t zero(n, 0.0);
+  EXPECT_EQ(st.statistic(zero.data(), v), 0.0);
+}
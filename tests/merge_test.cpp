@@ -27,12 +27,12 @@ TEST(merge, merge)
   auto [total_controls, total_cases] = get_total_kmer(km, 1, 1, 1);
 
 
-  std::shared_ptr<IModel<65536+1>> model {nullptr};
-  model = std::make_shared<PoissonLikelihood<65536+1>>(1, 1, total_controls, total_cases, 100);
+  std::shared_ptr<IModel<DMAX_C>> model {nullptr};
+  model = std::make_shared<PoissonLikelihood<DMAX_C>>(1, 1, total_controls, total_cases, 100);
 
   std::vector<uint32_t> a_min(1+1, 1);
 
-  global_merge<32, 65536+1> merger(
+  global_merge<32, DMAX_C> merger(
       part_paths, a_min, model, accs, config.kmer_size, 1, 1, 0.05/10000, 1, nullptr);
 
   auto T = merger.merge();
@@ -44,3 +44,48 @@ TEST(merge, merge)
   EXPECT_EQ(c1, 0);
   EXPECT_EQ(c2, 0);
 }
+
+TEST(merge, retain_save_sk)
+{
+  const std::string km = "./data_test/km_out_dir";
+
+  kmtricks_config_t config = get_kmtricks_config(km);
+  auto part_paths = get_partition_paths(km, config.nb_partitions);
+  auto [total_controls, total_cases] = get_total_kmer(km, 1, 1, 1);
+
+  std::shared_ptr<IModel<DMAX_C>> model = std::make_shared<PoissonLikelihood<DMAX_C>>(
+    1, 1, total_controls, total_cases, 100);
+  std::vector<uint32_t> a_min(1+1, 1);
+
+  // Every k-mer is retained, none of them is significant.
+  for (double level : {0.05/10000, 1.0})
+  {
+    const std::string smat = fmt::format("./tests_tmp/smat_{}", level);
+    fs::create_directories(smat);
+
+    std::vector<acc_t<KmerSign<32>>> accs(config.nb_partitions);
+    for (std::size_t i = 0; i < accs.size(); i++)
+      accs[i] = std::make_shared<VectorAccumulator<KmerSign<32>>>(100);
+
+    global_merge<32, DMAX_C> merger(
+        part_paths, a_min, model, accs, config.kmer_size, 1, 1, 1.0, 1, nullptr, smat);
+    merger.set_significance(level);
+
+    auto T = merger.merge();
+    EXPECT_EQ(merger.nb_sign(), T);
+
+    auto [c1, c2] = merger.signs();
+    std::size_t rows = 0;
+    for (std::size_t p = 0; p < config.nb_partitions; p++)
+    {
+      km::Kmer<32> k;
+      std::vector<kmer_count_t> cv(2);
+      km::MatrixReader mr(fmt::format("{}/matrix_{}.count.lz4", smat, p));
+      while (mr.template read<32, DMAX_C>(k, cv))
+        rows++;
+    }
+
+    EXPECT_EQ(c1 + c2, level < 1.0 ? 0 : T);
+    EXPECT_EQ(rows, c1 + c2);
+  }
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <kmdiff/pca.hpp>
+#include <kmdiff/popstrat.hpp>
+#include <kmdiff/exceptions.hpp>
+#include <cmath>
+#include <fstream>
+#include <random>
+
+using namespace kmdiff;
+
+TEST(pca, symmetric_eigen)
+{
+  dense_matrix m(matrix_t{
+    {4, 1, 2},
+    {1, 3, 0},
+    {2, 0, 5},
+  });
+
+  vector_t values;
+  dense_matrix vectors;
+  symmetric_eigen(m, values, vectors);
+
+  EXPECT_NEAR(values[0] + values[1] + values[2], 12.0, 1e-9);
+  EXPECT_GE(values[0], values[1]);
+  EXPECT_GE(values[1], values[2]);
+
+  for (std::size_t c = 0; c < 3; c++)
+  {
+    for (std::size_t r = 0; r < 3; r++)
+    {
+      double mv = 0;
+      for (std::size_t k = 0; k < 3; k++)
+        mv += m[r][k] * vectors[k][c];
+      EXPECT_NEAR(mv, values[c] * vectors[r][c], 1e-9);
+    }
+  }
+}
+
+TEST(pca, randomized)
+{
+  std::size_t n = 60;
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> dist;
+
+  {
+    std::ofstream out("./tests_tmp/pca.geno");
+    for (std::size_t i = 0; i < 3000; i++)
+    {
+      double f1 = dist(gen), f2 = dist(gen), f3 = dist(gen);
+      for (std::size_t j = 0; j < n; j++)
+      {
+        double f = j < 20 ? f1 : (j < 40 ? f2 : f3);
+        out << (dist(gen) < f ? "1\t" : "0\t");
+      }
+      out << "\n";
+    }
+  }
+
+  geno_matrix geno("./tests_tmp/pca.geno", n);
+  EXPECT_EQ(geno.rows(), 3000);
+
+  pca_result fast = randomized_pca(geno, 2, 1).run(2, 1);
+  pca_result fast_mt = randomized_pca(geno, 2, 4).run(2, 1);
+
+  std::size_t oversampling = randomized_pca::s_oversampling;
+  randomized_pca::s_oversampling = n;
+  pca_result exact = randomized_pca(geno, 2, 2).run(2);
+  randomized_pca::s_oversampling = oversampling;
+
+  for (std::size_t c = 0; c < 2; c++)
+  {
+    double dot = 0;
+    for (std::size_t j = 0; j < n; j++)
+    {
+      dot += fast.eigenvectors[j][c] * exact.eigenvectors[j][c];
+      EXPECT_EQ(fast.eigenvectors[j][c], fast_mt.eigenvectors[j][c]);
+    }
+    EXPECT_NEAR(std::abs(dot), 1.0, 1e-6);
+    EXPECT_NEAR(fast.eigenvalues[c], exact.eigenvalues[c], 1e-6 * exact.eigenvalues[c]);
+  }
+}
+
+TEST(pca, evec)
+{
+  pca_result pcs;
+  pcs.eigenvectors = matrix_t{{0.1, 0.2}, {0.3, 0.4}, {0.5, 0.6}, {0.7, 0.8}};
+
+  std::string path = "./tests_tmp/pcs.evec";
+  write_evec(path, pcs);
+  EXPECT_FALSE(fs::exists(path + ".tmp"));
+
+  pop_strat_corrector two(2, 2, {100, 100}, {100, 100}, 2);
+  EXPECT_NO_THROW(two.load_Z(path));
+
+  // Rows shorter than the number of principal components are rejected, not zero-padded.
+  pop_strat_corrector three(2, 2, {100, 100}, {100, 100}, 3);
+  EXPECT_THROW(three.load_Z(path), IOError);
+
+  {
+    std::ofstream out(path);
+    out << "0.1\t0.2\n0.3\t0.4\n0.5\n";
+  }
+  EXPECT_THROW(two.load_Z(path), IOError);
+}
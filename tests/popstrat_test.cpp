@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <kmdiff/popstrat.hpp>
+#include <kmdiff/merge.hpp>
+#include <kmdiff/utils.hpp>
+
+using namespace kmdiff;
+
+#ifdef WITH_POPSTRAT
+
+namespace {
+
+  constexpr std::size_t nb_controls = 12;
+  constexpr std::size_t nb_cases = 12;
+  constexpr std::size_t nb_samples = nb_controls + nb_cases;
+
+  // A corrector with two principal components, no covariate and unknown genders.
+  pop_strat_corrector_t make_corrector()
+  {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> dist(-1, 1);
+
+    vector_ull_t control_totals(nb_controls), case_totals(nb_cases);
+    for (std::size_t i = 0; i < nb_controls; i++)
+      control_totals[i] = 100000 + 1000 * i;
+    for (std::size_t i = 0; i < nb_cases; i++)
+      case_totals[i] = 110000 - 1000 * i;
+
+    std::string ind = "./tests_tmp/popstrat_test.ind";
+    {
+      std::ofstream out(ind);
+      for (std::size_t i = 0; i < nb_samples; i++)
+        out << "S" << i << "\tU\t" << (i < nb_controls ? "Control" : "Case") << "\n";
+    }
+
+    auto corrector = std::make_shared<pop_strat_corrector>(
+      nb_controls, nb_cases, control_totals, case_totals, 2);
+
+    matrix_t z(nb_samples, vector_t(2));
+    for (auto& row : z)
+      for (auto& v : row)
+        v = dist(gen);
+
+    corrector->set_Z(z);
+    corrector->load_Y(ind);
+    corrector->load_C("");
+    corrector->load_ginfo(ind);
+    corrector->init_global_features();
+    return corrector;
+  }
+
+  // nb_kmers k-mers drawn from nb_vectors distinct count vectors.
+  std::vector<KmerSign<32>> make_kmers(std::size_t nb_kmers, std::size_t nb_vectors)
+  {
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<std::uint32_t> count(0, 40);
+
+    std::vector<SparseCounts<kmer_count_t>> vectors(nb_vectors);
+    for (std::size_t v = 0; v < nb_vectors; v++)
+    {
+      std::vector<kmer_count_t> dense(nb_samples);
+      for (std::size_t i = 0; i < nb_samples; i++)
+        dense[i] = count(gen) * (i < nb_controls ? 1 : (v % 3) + 1) * (count(gen) > 10);
+      vectors[v].assign(dense, nb_controls);
+    }
+
+    std::vector<KmerSign<32>> kmers(nb_kmers);
+    for (std::size_t k = 0; k < nb_kmers; k++)
+    {
+      kmers[k].m_counts = vectors[(k * 7) % nb_vectors];
+      kmers[k].m_pvalue = 1;
+    }
+    return kmers;
+  }
+
+} // end of anonymous namespace
+
+TEST(popstrat, cache)
+{
+  auto corrector = make_corrector();
+
+  const std::size_t n = 256, distinct = 16;
+  std::vector<KmerSign<32>> kmers = make_kmers(n, distinct);
+
+  pop_strat_corrector::workspace ws(*corrector);
+  corrector->correct(kmers.data(), n, ws);
+
+  EXPECT_EQ(ws.lookups, n);
+  EXPECT_EQ(ws.hits, n - distinct);
+  EXPECT_NE(kmers[0].m_pvalue, kmers[1].m_pvalue);
+
+  // Each k-mer corrected alone, with an empty cache.
+  for (std::size_t k = 0; k < n; k++)
+  {
+    KmerSign<32> ks = make_kmers(n, distinct)[k];
+    pop_strat_corrector::workspace fresh(*corrector);
+    corrector->correct(&ks, 1, fresh);
+    EXPECT_EQ(fresh.hits, 0);
+    EXPECT_DOUBLE_EQ(kmers[k].m_pvalue, ks.m_pvalue);
+  }
+
+  // A second chunk with the same count vectors is served by the cache.
+  std::vector<KmerSign<32>> again = make_kmers(n, distinct);
+  corrector->correct(again.data(), n, ws);
+
+  EXPECT_EQ(ws.lookups, 2 * n);
+  EXPECT_EQ(ws.hits, 2 * n - distinct);
+  for (std::size_t k = 0; k < n; k++)
+    EXPECT_DOUBLE_EQ(kmers[k].m_pvalue, again[k].m_pvalue);
+}
+
+
+TEST(popstrat, fused)
+{
+  auto corrector = make_corrector();
+
+  std::vector<std::size_t> control_totals(nb_controls), case_totals(nb_cases);
+  for (std::size_t i = 0; i < nb_controls; i++)
+    control_totals[i] = 100000 + 1000 * i;
+  for (std::size_t i = 0; i < nb_cases; i++)
+    case_totals[i] = 110000 - 1000 * i;
+
+  std::shared_ptr<IModel<DMAX_C>> model = std::make_shared<PoissonLikelihood<DMAX_C>>(
+    nb_controls, nb_cases, control_totals, case_totals, 100);
+
+  // More k-mers than a chunk, with repeated count vectors.
+  const std::size_t n = pop_strat_corrector::s_chunk_size * 2 + 100;
+  std::vector<KmerSign<32>> signs = make_kmers(n, 200);
+  std::vector<km::Kmer<32>> kmers;
+  std::vector<std::vector<std::uint32_t>> counts(n, std::vector<std::uint32_t>(nb_samples));
+  for (std::size_t k = 0; k < n; k++)
+  {
+    kmers.emplace_back(random_dna_seq(31));
+    signs[k].m_counts.dense(counts[k].data());
+  }
+
+  auto read = [](const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream ss; ss << in.rdbuf();
+    return ss.str();
+  };
+
+  const double threshold = 0.5;
+
+  // Separate: merge, then correct the significant k-mers.
+  {
+    std::vector<acc_t<KmerSign<32>>> accs {
+      std::make_shared<FileAccumulator<KmerSign<32>>>("./tests_tmp/p0_separate", 31)};
+    std::vector<acc_t<KmerSign<32>>> pop_accs {
+      std::make_shared<FileAccumulator<KmerSign<32>>>("./tests_tmp/p0_separate_popstrat_uncorrected", 31)};
+
+    diff_observer<32, DMAX_C> obs(model, accs[0], threshold, nb_controls, nb_cases, 0);
+    for (std::size_t k = 0; k < n; k++)
+      obs.process(kmers[k], counts[k]);
+    obs.flush();
+    accs[0]->finish();
+    EXPECT_GT(obs.nb_sign(), pop_strat_corrector::s_chunk_size);
+
+    corrector->apply<32>(accs, pop_accs, 2);
+  }
+
+  // Fused: corrected while merged.
+  {
+    acc_t<KmerSign<32>> acc =
+      std::make_shared<FileAccumulator<KmerSign<32>>>("./tests_tmp/p0_fused_popstrat_uncorrected", 31);
+    pop_strat_corrector::workspace ws(*corrector);
+
+    diff_observer_pop<32, DMAX_C> obs(model, acc, threshold, nb_controls, nb_cases, 0, corrector, ws);
+    for (std::size_t k = 0; k < n; k++)
+      obs.process(kmers[k], counts[k]);
+    obs.flush();
+    acc->finish();
+  }
+
+  std::string separate = read("./tests_tmp/p0_separate_popstrat_uncorrected");
+  std::string fused = read("./tests_tmp/p0_fused_popstrat_uncorrected");
+  EXPECT_FALSE(separate.empty());
+  EXPECT_EQ(separate, fused);
+}
+
+#endif
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include <kmdiff/shard.hpp>
+
+using namespace kmdiff;
+
+TEST(shard, ranges)
+{
+  EXPECT_EQ(parse_partitions("0-9", 10), std::make_pair(0UL, 10UL));
+  EXPECT_EQ(parse_partitions("3-3", 10), std::make_pair(3UL, 4UL));
+  EXPECT_THROW(parse_partitions("5-10", 10), ConfigError);
+  EXPECT_THROW(parse_partitions("5-4", 10), ConfigError);
+
+  EXPECT_EQ(parse_shard("0/3", 10), std::make_pair(0UL, 3UL));
+  EXPECT_EQ(parse_shard("1/3", 10), std::make_pair(3UL, 6UL));
+  EXPECT_EQ(parse_shard("2/3", 10), std::make_pair(6UL, 10UL));
+  EXPECT_THROW(parse_shard("3/3", 10), ConfigError);
+  EXPECT_THROW(parse_shard("0/11", 10), ConfigError);
+}
+
+TEST(shard, load)
+{
+  std::string dir = "./tests_tmp/shards_out";
+  fs::remove_all(dir);
+  fs::create_directories(shard_dir(dir));
+
+  shard_info a;
+  a.first = 0; a.last = 4; a.nb_partitions = 8; a.kmer_size = 31;
+  a.stage = "uncorrected"; a.key = "0123456789abcdef";
+  a.threshold = 0.05; a.cutoff = 100000; a.level = 0.05 / 100000;
+  a.total_kmers = 1000;
+  a.write(fmt::format("{}/{}.shard", shard_dir(dir), a.name()));
+
+  EXPECT_THROW(load_shards(dir), ConfigError);
+
+  shard_info b = a;
+  b.first = 4; b.last = 8; b.total_kmers = 500;
+  b.write(fmt::format("{}/{}.shard", shard_dir(dir), b.name()));
+
+  auto shards = load_shards(dir);
+  ASSERT_EQ(shards.size(), 2);
+  EXPECT_EQ(shards[0].name(), "0-3");
+  EXPECT_EQ(shards[1].total_kmers, 500);
+  EXPECT_EQ(shards[0].level, a.level);
+
+  b.key = "fedcba9876543210";
+  b.write(fmt::format("{}/{}.shard", shard_dir(dir), b.name()));
+  EXPECT_THROW(load_shards(dir), ConfigError);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#ifdef __linux__
+  #include <sched.h>
+#endif
+#include <kmdiff/threadpool.hpp>
+
+using namespace kmdiff;
+
+TEST(threadpool, tasks)
+{
+  ThreadPool pool(4);
+  std::atomic<std::size_t> sum {0};
+
+  for (std::size_t i = 0; i < 10000; i++)
+    pool.add_task([&sum, i](int id) { sum += i; },
+                  i % 2 ? TaskPriority::HIGH : TaskPriority::LOW);
+
+  pool.join_all();
+  EXPECT_EQ(sum, 10000 * 9999 / 2);
+}
+
+TEST(threadpool, nested_tasks)
+{
+  ThreadPool pool(4);
+  std::atomic<std::size_t> count {0};
+
+  for (std::size_t i = 0; i < 100; i++)
+  {
+    pool.add_task([&pool, &count](int id) {
+      std::atomic<std::size_t> done {0};
+      for (std::size_t j = 0; j < 100; j++)
+        pool.add_task([&count, &done](int id) { count++; done++; });
+      pool.wait_until([&done]() { return done == 100; });
+    });
+  }
+
+  pool.join_all();
+  EXPECT_EQ(count, 10000);
+}
+
+TEST(threadpool, exception)
+{
+  ThreadPool pool(2);
+  pool.add_task([](int id) { throw std::runtime_error("task error"); });
+  EXPECT_THROW(pool.join_all(), std::runtime_error);
+}
+
+#ifdef __linux__
+TEST(threadpool, pinned)
+{
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  ASSERT_EQ(sched_getaffinity(0, sizeof(cpu_set_t), &allowed), 0);
+
+  ThreadPool pool(4, true);
+  std::atomic<std::size_t> outside {0};
+
+  for (std::size_t i = 0; i < 100; i++)
+    pool.add_task([&allowed, &outside](int id) {
+      cpu_set_t mask;
+      CPU_ZERO(&mask);
+      sched_getaffinity(0, sizeof(cpu_set_t), &mask);
+      if (CPU_COUNT(&mask) != 1)
+        outside++;
+      for (int c = 0; c < CPU_SETSIZE; c++)
+        if (CPU_ISSET(c, &mask) && !CPU_ISSET(c, &allowed))
+          outside++;
+    });
+
+  pool.join_all();
+  EXPECT_EQ(outside, 0);
+}
+#endif
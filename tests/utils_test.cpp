@@ -23,6 +23,7 @@
 #include <kmdiff/utils.hpp>
 #include <kmdiff/kmer.hpp>
 #include <chrono>
+#include <sstream>
 
 using namespace kmdiff;
 
@@ -52,6 +53,48 @@ TEST(utils, Range)
     EXPECT_EQ(a[i], v[i+2]);
 }
 
+TEST(utils, SparseCounts)
+{
+  std::vector<std::uint32_t> v{0, 4, 0, 3, 0, 2};
+  SparseCounts<std::uint32_t> sc;
+  sc.assign(v, 3);
+
+  EXPECT_EQ(sc.size(), 6);
+  EXPECT_EQ(sc.nnz(), 3);
+  EXPECT_EQ(sc.sum_controls(), 4);
+  EXPECT_EQ(sc.sum_cases(), 5);
+  EXPECT_EQ(sc.positive_controls(), 1);
+  EXPECT_EQ(sc.positive_cases(), 2);
+
+  std::vector<std::uint32_t> d(sc.size());
+  sc.dense(d.data());
+  EXPECT_EQ(d, v);
+
+  // Counts of a narrower type are widened.
+  std::vector<std::uint8_t> n{0, 4, 0, 3, 0, 2};
+  SparseCounts<std::uint8_t> narrow;
+  narrow.assign(n, 3);
+  SparseCounts<std::uint32_t> wide(narrow);
+  EXPECT_EQ(wide.index(), sc.index());
+  EXPECT_EQ(wide.value(), sc.value());
+  EXPECT_EQ(wide.sum_cases(), 5);
+  EXPECT_EQ(wide.positive_controls(), 1);
+
+  std::stringstream ss;
+  sc.dump(ss);
+  SparseCounts<std::uint32_t> loaded;
+  loaded.load(ss);
+  EXPECT_EQ(loaded.size(), sc.size());
+  EXPECT_EQ(loaded.index(), sc.index());
+  EXPECT_EQ(loaded.value(), sc.value());
+
+  // More nonzero counts than entries, e.g. a corrupt record.
+  std::stringstream corrupt;
+  std::uint32_t header[2] = {2, 0xffffffff};
+  corrupt.write(reinterpret_cast<const char*>(header), sizeof(header));
+  EXPECT_THROW(loaded.load(corrupt), IOError);
+}
+
 TEST(utils, slice)
 {
   std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
@@ -1,8 +0,0 @@
-#include <vsubs.h>
-#include <strsubs.h>
-#include <sortit.h>
-#include <statsubs.h>
-#include <linsubs.h>  
-#include <ranmath.h>
-#include <xsearch.h>
-
@@ -1,863 +0,0 @@
-Flat profile:
-
-Each sample counts as 0.01 seconds.
-  %   cumulative   self              self     total           
- time   seconds   seconds    calls   s/call   s/call  name    
- 15.99      2.49     2.49 320000000     0.00     0.00  rbuff
- 14.58      4.76     2.27    40000     0.00     0.00  vdot
- 13.49      6.86     2.10 320000000     0.00     0.00  getgtypes
- 12.40      8.79     1.93                             printevecs
- 10.28     10.39     1.60 240000000     0.00     0.00  getggval
-  8.86     11.77     1.38   120000     0.00     0.00  kjg_geno_get_normalized_row
-  3.98     12.39     0.62 20000000     0.00     0.00  wbuff
-  3.92     13.00     0.61        1     0.61     1.73  ineigenstrat
-  3.34     13.52     0.52 220000000     0.00     0.00  getgval
-  1.93     13.82     0.30                             fvadjust
-  1.93     14.12     0.30    10000     0.00     0.00  getgall
-  1.16     14.30     0.18        1     0.18     0.18  unsetgval
-  1.09     14.47     0.17    10000     0.00     0.00  numvalidgt
-  1.03     14.63     0.16    10000     0.00     0.00  numvalidgtx
-  1.03     14.79     0.16                             getcolxz
-  0.90     14.93     0.14    10000     0.00     0.00  floatit
-  0.71     15.04     0.11 40000000     0.00     0.00  checkxval
-  0.71     15.15     0.11    34005     0.00     0.00  splitupwxbuff
-  0.71     15.26     0.11    10020     0.00     0.00  vst
-  0.64     15.36     0.10        1     0.10     0.40  numvalidgtallind
-  0.45     15.43     0.07 20000000     0.00     0.00  putgtypes
-  0.26     15.47     0.04                             LAPACKE_dge_trans
-  0.19     15.50     0.03    30001     0.00     0.00  cclear
-  0.19     15.53     0.03    10000     0.00     0.00  getrawcol
-  0.06     15.54     0.01      100     0.00     0.00  vlmaxmin
-  0.06     15.55     0.01        1     0.01     0.01  freeped
-  0.06     15.56     0.01                             LAPACKE_dge_nancheck
-  0.06     15.57     0.01                             hashit
-  0.00     15.57     0.00   142006     0.00     0.00  freestring
-  0.00     15.57     0.00    64608     0.00     0.00  compiarr
-  0.00     15.57     0.00    34005     0.00     0.00  freeup
-  0.00     15.57     0.00    34005     0.00     0.00  splitup
-  0.00     15.57     0.00    30101     0.00     0.00  nnint
-  0.00     15.57     0.00    24000     0.00     0.00  setskipit
-  0.00     15.57     0.00    20001     0.00     0.00  copyiarr
-  0.00     15.57     0.00    20000     0.00     0.00  intsum
-  0.00     15.57     0.00    20000     0.00     0.00  kjg_gsl_ran_ugaussian_pair
-  0.00     15.57     0.00    20000     0.00     0.00  mknn
-  0.00     15.57     0.00    20000     0.00     0.00  mkupper
-  0.00     15.57     0.00    10002     0.00     0.00  ivclear
-  0.00     15.57     0.00    10001     0.00     0.00  NPisnumber
-  0.00     15.57     0.00    10001     0.00     0.00  isnumword
-  0.00     15.57     0.00    10001     0.00     0.00  ivzero
-  0.00     15.57     0.00    10000     0.00     0.00  clearsnp
-  0.00     15.57     0.00    10000     0.00     0.00  setsdpos
-  0.00     15.57     0.00    10000     0.00     0.00  str2chrom
-  0.00     15.57     0.00     2003     0.00     0.00  vclear
-  0.00     15.57     0.00     2000     0.00     0.00  indxindex
-  0.00     15.57     0.00     2000     0.00     0.00  vzero
-  0.00     15.57     0.00      480     0.00     0.00  kjg_geno_get_normalized_rows
-  0.00     15.57     0.00       97     0.00     0.00  findpname
-  0.00     15.57     0.00       55     0.00     0.00  getint
-  0.00     15.57     0.00       31     0.00     0.00  getstring
-  0.00     15.57     0.00       13     0.00     0.00  get_ncols
-  0.00     15.57     0.00       13     0.00     0.00  get_nrows
-  0.00     15.57     0.00       11     0.00     0.00  copyarr
-  0.00     15.57     0.00       11     0.00     0.00  getdbl
-  0.00     15.57     0.00       10     0.00     0.00  asum2
-  0.00     15.57     0.00       10     0.00     0.12  kjg_fpca_XTXA
-  0.00     15.57     0.00       10     0.00     0.00  kjg_gsl_dgeqrf
-  0.00     15.57     0.00       10     0.00     0.00  kjg_gsl_dorgqr
-  0.00     15.57     0.00       10     0.00     0.00  kjg_gsl_matrix_QR
-  0.00     15.57     0.00        8     0.00     0.00  fnwhite
-  0.00     15.57     0.00        6     0.00     0.00  openit
-  0.00     15.57     0.00        4     0.00     0.00  first_word
-  0.00     15.57     0.00        4     0.00     0.00  fwhite
-  0.00     15.57     0.00        4     0.00     0.00  indxstring
-  0.00     15.57     0.00        4     0.00     0.00  stripcomment
-  0.00     15.57     0.00        4     0.00     0.00  striptrail
-  0.00     15.57     0.00        4     0.00     0.00  upstring
-  0.00     15.57     0.00        2     0.00     0.02  getsizex
-  0.00     15.57     0.00        2     0.00     0.00  ispedfile
-  0.00     15.57     0.00        2     0.00     0.00  kjg_gsl_SVD
-  0.00     15.57     0.00        2     0.00     0.00  nextmesh
-  0.00     15.57     0.00        1     0.00     0.00  checksize
-  0.00     15.57     0.00        1     0.00     0.00  clearepath
-  0.00     15.57     0.00        1     0.00     0.00  clearind
-  0.00     15.57     0.00        1     0.00     0.00  cleartg
-  0.00     15.57     0.00        1     0.00     0.00  copyiparr
-  0.00     15.57     0.00        1     0.00     0.00  dobadsnps
-  0.00     15.57     0.00        1     0.00     0.00  dostrsub
-  0.00     15.57     0.00        1     0.00     0.00  freesnpindex
-  0.00     15.57     0.00        1     0.00     1.74  getgenos
-  0.00     15.57     0.00        1     0.00     0.03  getindivs
-  0.00     15.57     0.00        1     0.00     0.08  getsnps
-  0.00     15.57     0.00        1     0.00     0.00  initarray_2Ddouble
-  0.00     15.57     0.00        1     0.00     0.00  ipsortit
-  0.00     15.57     0.00        1     0.00     0.00  ipsortitp
-  0.00     15.57     0.00        1     0.00     0.00  isbedfile
-  0.00     15.57     0.00        1     0.00     0.00  iseigenstrat
-  0.00     15.57     0.00        1     0.00     0.00  ismapfile
-  0.00     15.57     0.00        1     0.00     0.00  ispack
-  0.00     15.57     0.00        1     0.00     1.38  kjg_fpca
-  0.00     15.57     0.00        1     0.00     0.12  kjg_fpca_XA
-  0.00     15.57     0.00        1     0.00     0.12  kjg_fpca_XTB
-  0.00     15.57     0.00        1     0.00     0.00  kjg_gsl_ran_ugaussian_matrix
-  0.00     15.57     0.00        1     0.00     0.00  kjg_gsl_rng_init
-  0.00     15.57     0.00        1     0.00     0.00  loadindx
-  0.00     15.57     0.00        1     0.00     0.00  loadsnps
-  0.00     15.57     0.00        1     0.00     0.46  loadsnpx
-  0.00     15.57     0.00        1     0.00     0.00  makeeglist
-  0.00     15.57     0.00        1     0.00     0.00  numfakes
-  0.00     15.57     0.00        1     0.00     0.00  openpars
-  0.00     15.57     0.00        1     0.00     0.00  pcheck
-  0.00     15.57     0.00        1     0.00     0.01  readinddata
-  0.00     15.57     0.00        1     0.00     0.03  readsnpdata
-  0.00     15.57     0.00        1     0.00     0.00  rmsnps
-  0.00     15.57     0.00        1     0.00     0.00  set_ind_mask
-  0.00     15.57     0.00        1     0.00     0.00  setfvecs
-  0.00     15.57     0.00        1     0.00     0.18  setgval
-  0.00     15.57     0.00        1     0.00     0.00  setomode
-  0.00     15.57     0.00        1     0.00     0.00  setorder
-  0.00     15.57     0.00        1     0.00     0.00  setstatus
-  0.00     15.57     0.00        1     0.00     0.00  setstatusv
-  0.00     15.57     0.00        1     0.00     0.00  transpose
-  0.00     15.57     0.00        1     0.00     0.00  vinvert
-  0.00     15.57     0.00        1     0.00     0.00  vsqrt
-  0.00     15.57     0.00        1     0.00     0.00  writepars
-
- %         the percentage of the total running time of the
-time       program used by this function.
-
-cumulative a running sum of the number of seconds accounted
- seconds   for by this function and those listed above it.
-
- self      the number of seconds accounted for by this
-seconds    function alone.  This is the major sort for this
-           listing.
-
-calls      the number of times this function was invoked, if
-           this function is profiled, else blank.
- 
- self      the average number of milliseconds spent in this
-ms/call    function per call, if this function is profiled,
-	   else blank.
-
- total     the average number of milliseconds spent in this
-ms/call    function and its descendents per call, if this 
-	   function is profiled, else blank.
-
-name       the name of the function.  This is the minor sort
-           for this listing. The index shows the location of
-	   the function in the gprof listing. If the index is
-	   in parenthesis it shows where it would appear in
-	   the gprof listing if it were to be printed.
-
-		     Call graph (explanation follows)
-
-
-granularity: each sample hit covers 2 byte(s) for 0.06% of 15.57 seconds
-
-index % time    self  children    called     name
-                                                 <spontaneous>
-[1]     62.7    1.93    7.83                 printevecs [1]
-                0.52    4.62 220000000/220000000     getgval [2]
-                2.27    0.00   40000/40000       vdot [7]
-                0.13    0.29 20000000/240000000     getggval [3]
-                0.00    0.00       1/1           setfvecs [46]
-                0.00    0.00       1/1           vsqrt [120]
-                0.00    0.00       1/1           vinvert [119]
------------------------------------------------
-                0.52    4.62 220000000/220000000     printevecs [1]
-[2]     33.0    0.52    4.62 220000000         getgval [2]
-                1.47    3.16 220000000/240000000     getggval [3]
------------------------------------------------
-                0.13    0.29 20000000/240000000     printevecs [1]
-                1.47    3.16 220000000/240000000     getgval [2]
-[3]     32.4    1.60    3.44 240000000         getggval [3]
-                1.58    1.87 240000000/320000000     getgtypes [5]
------------------------------------------------
-                                                 <spontaneous>
-[4]     30.3    0.00    4.71                 main [4]
-                0.00    1.74       1/1           getgenos [8]
-                0.00    1.38       1/1           kjg_fpca [12]
-                0.00    0.46       1/1           loadsnpx [18]
-                0.16    0.29   10000/10000       numvalidgtx [19]
-                0.10    0.30       1/1           numvalidgtallind [20]
-                0.00    0.18       1/1           setgval [24]
-                0.00    0.08       1/1           getsnps [33]
-                0.00    0.03       1/1           getindivs [38]
-                0.00    0.00   10000/30101       nnint [55]
-                0.00    0.00       1/1           setomode [114]
-                0.00    0.00       1/1           setstatus [116]
-                0.00    0.00       1/1           makeeglist [108]
-                0.00    0.00       1/1           rmsnps [112]
-                0.00    0.00       1/1           loadindx [106]
-                0.00    0.00       1/1           transpose [118]
------------------------------------------------
-                0.13    0.16 20000000/320000000     ineigenstrat [9]
-                0.13    0.16 20000000/320000000     getrawcol [21]
-                0.13    0.16 20000000/320000000     numvalidgt [17]
-                0.13    0.16 20000000/320000000     numvalidgtx [19]
-                1.58    1.87 240000000/320000000     getggval [3]
-[5]     29.5    2.10    2.49 320000000         getgtypes [5]
-                2.49    0.00 320000000/320000000     rbuff [6]
------------------------------------------------
-                2.49    0.00 320000000/320000000     getgtypes [5]
-[6]     16.0    2.49    0.00 320000000         rbuff [6]
------------------------------------------------
-                2.27    0.00   40000/40000       printevecs [1]
-[7]     14.6    2.27    0.00   40000         vdot [7]
------------------------------------------------
-                0.00    1.74       1/1           main [4]
-[8]     11.2    0.00    1.74       1         getgenos [8]
-                0.61    1.12       1/1           ineigenstrat [9]
-                0.01    0.00       1/1           freeped [42]
-                0.00    0.00       1/1           iseigenstrat [50]
-                0.00    0.00       1/1           checksize [91]
-                0.00    0.00       1/2           ispedfile [88]
-                0.00    0.00       1/1           isbedfile [101]
-                0.00    0.00       1/1           ispack [103]
------------------------------------------------
-                0.61    1.12       1/1           getgenos [8]
-[9]     11.1    0.61    1.12       1         ineigenstrat [9]
-                0.07    0.62 20000000/20000000     putgtypes [15]
-                0.13    0.16 20000000/320000000     getgtypes [5]
-                0.11    0.00 40000000/40000000     checkxval [29]
-                0.00    0.03   10000/34005       splitup [30]
-                0.00    0.00       1/1           clearepath [51]
-                0.00    0.00   10000/34005       freeup [54]
-                0.00    0.00       1/30101       nnint [55]
-                0.00    0.00       1/6           openit [81]
-                0.00    0.00       1/142006      freestring [52]
------------------------------------------------
-                1.38    0.00  120000/120000      kjg_geno_get_normalized_rows [11]
-[10]     8.9    1.38    0.00  120000         kjg_geno_get_normalized_row [10]
------------------------------------------------
-                0.00    0.12      40/480         kjg_fpca_XA [27]
-                0.00    0.12      40/480         kjg_fpca_XTB [28]
-                0.00    1.15     400/480         kjg_fpca_XTXA [13]
-[11]     8.9    0.00    1.38     480         kjg_geno_get_normalized_rows [11]
-                1.38    0.00  120000/120000      kjg_geno_get_normalized_row [10]
------------------------------------------------
-                0.00    1.38       1/1           main [4]
-[12]     8.9    0.00    1.38       1         kjg_fpca [12]
-                0.00    1.15      10/10          kjg_fpca_XTXA [13]
-                0.00    0.12       1/1           kjg_fpca_XA [27]
-                0.00    0.12       1/1           kjg_fpca_XTB [28]
-                0.00    0.00      10/10          kjg_gsl_matrix_QR [79]
-                0.00    0.00       2/2           kjg_gsl_SVD [89]
-                0.00    0.00       1/13          get_nrows [73]
-                0.00    0.00       1/13          get_ncols [72]
-                0.00    0.00       1/1           kjg_gsl_rng_init [105]
-                0.00    0.00       1/1           kjg_gsl_ran_ugaussian_matrix [104]
------------------------------------------------
-                0.00    1.15      10/10          kjg_fpca [12]
-[13]     7.4    0.00    1.15      10         kjg_fpca_XTXA [13]
-                0.00    1.15     400/480         kjg_geno_get_normalized_rows [11]
-                0.00    0.00      10/13          get_ncols [72]
-                0.00    0.00      10/13          get_nrows [73]
------------------------------------------------
-                                                 <spontaneous>
-[14]     4.7    0.16    0.57                 getcolxz [14]
-                0.03    0.29   10000/10000       getrawcol [21]
-                0.14    0.00   10000/10000       floatit [26]
-                0.11    0.00   10000/10020       vst [32]
------------------------------------------------
-                0.07    0.62 20000000/20000000     ineigenstrat [9]
-[15]     4.4    0.07    0.62 20000000         putgtypes [15]
-                0.62    0.00 20000000/20000000     wbuff [16]
------------------------------------------------
-                0.62    0.00 20000000/20000000     putgtypes [15]
-[16]     4.0    0.62    0.00 20000000         wbuff [16]
------------------------------------------------
-                0.17    0.29   10000/10000       loadsnpx [18]
-[17]     2.9    0.17    0.29   10000         numvalidgt [17]
-                0.13    0.16 20000000/320000000     getgtypes [5]
------------------------------------------------
-                0.00    0.46       1/1           main [4]
-[18]     2.9    0.00    0.46       1         loadsnpx [18]
-                0.17    0.29   10000/10000       numvalidgt [17]
------------------------------------------------
-                0.16    0.29   10000/10000       main [4]
-[19]     2.9    0.16    0.29   10000         numvalidgtx [19]
-                0.13    0.16 20000000/320000000     getgtypes [5]
------------------------------------------------
-                0.10    0.30       1/1           main [4]
-[20]     2.6    0.10    0.30       1         numvalidgtallind [20]
-                0.30    0.00   10000/10000       getgall [23]
-                0.00    0.00       1/10001       ivzero [65]
------------------------------------------------
-                0.03    0.29   10000/10000       getcolxz [14]
-[21]     2.0    0.03    0.29   10000         getrawcol [21]
-                0.13    0.16 20000000/320000000     getgtypes [5]
------------------------------------------------
-                                                 <spontaneous>
-[22]     1.9    0.30    0.00                 fvadjust [22]
------------------------------------------------
-                0.30    0.00   10000/10000       numvalidgtallind [20]
-[23]     1.9    0.30    0.00   10000         getgall [23]
------------------------------------------------
-                0.00    0.18       1/1           main [4]
-[24]     1.2    0.00    0.18       1         setgval [24]
-                0.18    0.00       1/1           unsetgval [25]
-                0.00    0.00       1/2003        vclear [68]
-                0.00    0.00       1/1           initarray_2Ddouble [98]
-                0.00    0.00       1/1           set_ind_mask [113]
------------------------------------------------
-                0.18    0.00       1/1           setgval [24]
-[25]     1.2    0.18    0.00       1         unsetgval [25]
------------------------------------------------
-                0.14    0.00   10000/10000       getcolxz [14]
-[26]     0.9    0.14    0.00   10000         floatit [26]
------------------------------------------------
-                0.00    0.12       1/1           kjg_fpca [12]
-[27]     0.7    0.00    0.12       1         kjg_fpca_XA [27]
-                0.00    0.12      40/480         kjg_geno_get_normalized_rows [11]
-                0.00    0.00       1/13          get_nrows [73]
-                0.00    0.00       1/13          get_ncols [72]
------------------------------------------------
-                0.00    0.12       1/1           kjg_fpca [12]
-[28]     0.7    0.00    0.12       1         kjg_fpca_XTB [28]
-                0.00    0.12      40/480         kjg_geno_get_normalized_rows [11]
-                0.00    0.00       1/13          get_nrows [73]
-                0.00    0.00       1/13          get_ncols [72]
------------------------------------------------
-                0.11    0.00 40000000/40000000     ineigenstrat [9]
-[29]     0.7    0.11    0.00 40000000         checkxval [29]
------------------------------------------------
-                0.00    0.00       1/34005       iseigenstrat [50]
-                0.00    0.00       1/34005       getint [49]
-                0.00    0.00       3/34005       getstring [48]
-                0.00    0.01    2000/34005       readinddata [45]
-                0.00    0.03   10000/34005       readsnpdata [36]
-                0.00    0.03   10000/34005       ineigenstrat [9]
-                0.00    0.04   12000/34005       getsizex [35]
-[30]     0.7    0.00    0.11   34005         splitup [30]
-                0.11    0.00   34005/34005       splitupwxbuff [31]
------------------------------------------------
-                0.11    0.00   34005/34005       splitup [30]
-[31]     0.7    0.11    0.00   34005         splitupwxbuff [31]
------------------------------------------------
-                0.00    0.00      10/10020       writesnpeigs [40]
-                0.00    0.00      10/10020       setfvecs [46]
-                0.11    0.00   10000/10020       getcolxz [14]
-[32]     0.7    0.11    0.00   10020         vst [32]
------------------------------------------------
-                0.00    0.08       1/1           main [4]
-[33]     0.5    0.00    0.08       1         getsnps [33]
-                0.00    0.03       1/1           readsnpdata [36]
-                0.00    0.02   10000/10000       clearsnp [39]
-                0.00    0.02       1/2           getsizex [35]
-                0.01    0.00   10000/30001       cclear [37]
-                0.00    0.00   20000/30101       nnint [55]
-                0.00    0.00       1/10002       ivclear [62]
-                0.00    0.00       1/1           dobadsnps [95]
-                0.00    0.00       1/1           ipsortit [99]
-                0.00    0.00       1/1           numfakes [109]
-                0.00    0.00       1/1           loadsnps [107]
-                0.00    0.00       1/10001       isnumword [64]
------------------------------------------------
-                                                 <spontaneous>
-[34]     0.3    0.04    0.00                 LAPACKE_dge_trans [34]
------------------------------------------------
-                0.00    0.02       1/2           getsnps [33]
-                0.00    0.02       1/2           getindivs [38]
-[35]     0.2    0.00    0.04       2         getsizex [35]
-                0.00    0.04   12000/34005       splitup [30]
-                0.00    0.00   12000/24000       setskipit [56]
-                0.00    0.00   12000/34005       freeup [54]
-                0.00    0.00       2/6           openit [81]
------------------------------------------------
-                0.00    0.03       1/1           getsnps [33]
-[36]     0.2    0.00    0.03       1         readsnpdata [36]
-                0.00    0.03   10000/34005       splitup [30]
-                0.00    0.00   10000/24000       setskipit [56]
-                0.00    0.00   10000/10000       str2chrom [67]
-                0.00    0.00   10000/10000       setsdpos [66]
-                0.00    0.00   10000/10001       ivzero [65]
-                0.00    0.00   10000/34005       freeup [54]
-                0.00    0.00       1/1           ismapfile [102]
-                0.00    0.00       1/2003        vclear [68]
-                0.00    0.00       1/6           openit [81]
------------------------------------------------
-                0.00    0.00       1/30001       clearepath [51]
-                0.01    0.00   10000/30001       getsnps [33]
-                0.02    0.00   20000/30001       clearsnp [39]
-[37]     0.2    0.03    0.00   30001         cclear [37]
------------------------------------------------
-                0.00    0.03       1/1           main [4]
-[38]     0.2    0.00    0.03       1         getindivs [38]
-                0.00    0.02       1/2           getsizex [35]
-                0.00    0.01       1/1           readinddata [45]
-                0.00    0.00       1/1           clearind [92]
------------------------------------------------
-                0.00    0.02   10000/10000       getsnps [33]
-[39]     0.1    0.00    0.02   10000         clearsnp [39]
-                0.02    0.00   20000/30001       cclear [37]
------------------------------------------------
-                                                 <spontaneous>
-[40]     0.1    0.00    0.01                 writesnpeigs [40]
-                0.01    0.00     100/100         vlmaxmin [41]
-                0.00    0.00      10/10020       vst [32]
-                0.00    0.00     100/30101       nnint [55]
-                0.00    0.00      10/10          asum2 [76]
-                0.00    0.00       1/2003        vclear [68]
------------------------------------------------
-                0.01    0.00     100/100         writesnpeigs [40]
-[41]     0.1    0.01    0.00     100         vlmaxmin [41]
------------------------------------------------
-                0.01    0.00       1/1           getgenos [8]
-[42]     0.1    0.01    0.00       1         freeped [42]
------------------------------------------------
-                                                 <spontaneous>
-[43]     0.1    0.01    0.00                 LAPACKE_dge_nancheck [43]
------------------------------------------------
-                                                 <spontaneous>
-[44]     0.1    0.01    0.00                 hashit [44]
------------------------------------------------
-                0.00    0.01       1/1           getindivs [38]
-[45]     0.0    0.00    0.01       1         readinddata [45]
-                0.00    0.01    2000/34005       splitup [30]
-                0.00    0.00    2000/24000       setskipit [56]
-                0.00    0.00    2000/34005       freeup [54]
-                0.00    0.00       1/2           ispedfile [88]
-                0.00    0.00       1/6           openit [81]
------------------------------------------------
-                0.00    0.00       1/1           printevecs [1]
-[46]     0.0    0.00    0.00       1         setfvecs [46]
-                0.00    0.00      10/10020       vst [32]
-                0.00    0.00      10/11          copyarr [74]
------------------------------------------------
-                                                 <spontaneous>
-[47]     0.0    0.00    0.00                 readcommands [47]
-                0.00    0.00      31/31          getstring [48]
-                0.00    0.00      55/55          getint [49]
-                0.00    0.00      11/11          getdbl [75]
-                0.00    0.00       1/1           pcheck [111]
-                0.00    0.00       1/1           openpars [110]
-                0.00    0.00       1/1           dostrsub [96]
-                0.00    0.00       1/1           writepars [121]
------------------------------------------------
-                0.00    0.00      31/31          readcommands [47]
-[48]     0.0    0.00    0.00      31         getstring [48]
-                0.00    0.00       3/34005       splitup [30]
-                0.00    0.00      31/97          findpname [71]
-                0.00    0.00       3/34005       freeup [54]
------------------------------------------------
-                0.00    0.00      55/55          readcommands [47]
-[49]     0.0    0.00    0.00      55         getint [49]
-                0.00    0.00       1/34005       splitup [30]
-                0.00    0.00      55/97          findpname [71]
-                0.00    0.00       1/34005       freeup [54]
------------------------------------------------
-                0.00    0.00       1/1           getgenos [8]
-[50]     0.0    0.00    0.00       1         iseigenstrat [50]
-                0.00    0.00       1/34005       splitup [30]
-                0.00    0.00       1/6           openit [81]
-                0.00    0.00       1/34005       freeup [54]
------------------------------------------------
-                0.00    0.00       1/1           ineigenstrat [9]
-[51]     0.0    0.00    0.00       1         clearepath [51]
-                0.00    0.00       1/30001       cclear [37]
------------------------------------------------
-                0.00    0.00       1/142006      ineigenstrat [9]
-                0.00    0.00  142005/142006      freeup [54]
-[52]     0.0    0.00    0.00  142006         freestring [52]
------------------------------------------------
-                0.00    0.00   64608/64608       ipcompit [400]
-[53]     0.0    0.00    0.00   64608         compiarr [53]
------------------------------------------------
-                0.00    0.00       1/34005       iseigenstrat [50]
-                0.00    0.00       1/34005       getint [49]
-                0.00    0.00       3/34005       getstring [48]
-                0.00    0.00    2000/34005       readinddata [45]
-                0.00    0.00   10000/34005       readsnpdata [36]
-                0.00    0.00   10000/34005       ineigenstrat [9]
-                0.00    0.00   12000/34005       getsizex [35]
-[54]     0.0    0.00    0.00   34005         freeup [54]
-                0.00    0.00  142005/142006      freestring [52]
------------------------------------------------
-                0.00    0.00       1/30101       ineigenstrat [9]
-                0.00    0.00     100/30101       writesnpeigs [40]
-                0.00    0.00   10000/30101       main [4]
-                0.00    0.00   20000/30101       getsnps [33]
-[55]     0.0    0.00    0.00   30101         nnint [55]
------------------------------------------------
-                0.00    0.00    2000/24000       readinddata [45]
-                0.00    0.00   10000/24000       readsnpdata [36]
-                0.00    0.00   12000/24000       getsizex [35]
-[56]     0.0    0.00    0.00   24000         setskipit [56]
------------------------------------------------
-                0.00    0.00       1/20001       ipsortitp [100]
-                0.00    0.00   20000/20001       loadsnps [107]
-[57]     0.0    0.00    0.00   20001         copyiarr [57]
------------------------------------------------
-                0.00    0.00   20000/20000       mknn [60]
-[58]     0.0    0.00    0.00   20000         intsum [58]
------------------------------------------------
-                0.00    0.00   20000/20000       kjg_gsl_ran_ugaussian_matrix [104]
-[59]     0.0    0.00    0.00   20000         kjg_gsl_ran_ugaussian_pair [59]
------------------------------------------------
-                0.00    0.00   20000/20000       loadsnps [107]
-[60]     0.0    0.00    0.00   20000         mknn [60]
-                0.00    0.00   20000/20000       intsum [58]
------------------------------------------------
-                0.00    0.00   10000/20000       setsdpos [66]
-                0.00    0.00   10000/20000       str2chrom [67]
-[61]     0.0    0.00    0.00   20000         mkupper [61]
------------------------------------------------
-                0.00    0.00       1/10002       getsnps [33]
-                0.00    0.00   10001/10002       ivzero [65]
-[62]     0.0    0.00    0.00   10002         ivclear [62]
------------------------------------------------
-                0.00    0.00   10001/10001       isnumword [64]
-[63]     0.0    0.00    0.00   10001         NPisnumber [63]
------------------------------------------------
-                0.00    0.00       1/10001       getsnps [33]
-                0.00    0.00   10000/10001       str2chrom [67]
-[64]     0.0    0.00    0.00   10001         isnumword [64]
-                0.00    0.00   10001/10001       NPisnumber [63]
------------------------------------------------
-                0.00    0.00       1/10001       numvalidgtallind [20]
-                0.00    0.00   10000/10001       readsnpdata [36]
-[65]     0.0    0.00    0.00   10001         ivzero [65]
-                0.00    0.00   10001/10002       ivclear [62]
------------------------------------------------
-                0.00    0.00   10000/10000       readsnpdata [36]
-[66]     0.0    0.00    0.00   10000         setsdpos [66]
-                0.00    0.00   10000/20000       mkupper [61]
------------------------------------------------
-                0.00    0.00   10000/10000       readsnpdata [36]
-[67]     0.0    0.00    0.00   10000         str2chrom [67]
-                0.00    0.00   10000/20000       mkupper [61]
-                0.00    0.00   10000/10001       isnumword [64]
------------------------------------------------
-                0.00    0.00       1/2003        writesnpeigs [40]
-                0.00    0.00       1/2003        readsnpdata [36]
-                0.00    0.00       1/2003        setgval [24]
-                0.00    0.00    2000/2003        vzero [70]
-[68]     0.0    0.00    0.00    2003         vclear [68]
------------------------------------------------
-                0.00    0.00    2000/2000        makeeglist [108]
-[69]     0.0    0.00    0.00    2000         indxindex [69]
------------------------------------------------
-                0.00    0.00    2000/2000        cleartg [93]
-[70]     0.0    0.00    0.00    2000         vzero [70]
-                0.00    0.00    2000/2003        vclear [68]
------------------------------------------------
-                0.00    0.00      11/97          getdbl [75]
-                0.00    0.00      31/97          getstring [48]
-                0.00    0.00      55/97          getint [49]
-[71]     0.0    0.00    0.00      97         findpname [71]
------------------------------------------------
-                0.00    0.00       1/13          kjg_fpca [12]
-                0.00    0.00       1/13          kjg_fpca_XA [27]
-                0.00    0.00       1/13          kjg_fpca_XTB [28]
-                0.00    0.00      10/13          kjg_fpca_XTXA [13]
-[72]     0.0    0.00    0.00      13         get_ncols [72]
------------------------------------------------
-                0.00    0.00       1/13          kjg_fpca [12]
-                0.00    0.00       1/13          kjg_fpca_XA [27]
-                0.00    0.00       1/13          kjg_fpca_XTB [28]
-                0.00    0.00      10/13          kjg_fpca_XTXA [13]
-[73]     0.0    0.00    0.00      13         get_nrows [73]
------------------------------------------------
-                0.00    0.00       1/11          transpose [118]
-                0.00    0.00      10/11          setfvecs [46]
-[74]     0.0    0.00    0.00      11         copyarr [74]
------------------------------------------------
-                0.00    0.00      11/11          readcommands [47]
-[75]     0.0    0.00    0.00      11         getdbl [75]
-                0.00    0.00      11/97          findpname [71]
------------------------------------------------
-                0.00    0.00      10/10          writesnpeigs [40]
-[76]     0.0    0.00    0.00      10         asum2 [76]
------------------------------------------------
-                0.00    0.00      10/10          kjg_gsl_matrix_QR [79]
-[77]     0.0    0.00    0.00      10         kjg_gsl_dgeqrf [77]
------------------------------------------------
-                0.00    0.00      10/10          kjg_gsl_matrix_QR [79]
-[78]     0.0    0.00    0.00      10         kjg_gsl_dorgqr [78]
------------------------------------------------
-                0.00    0.00      10/10          kjg_fpca [12]
-[79]     0.0    0.00    0.00      10         kjg_gsl_matrix_QR [79]
-                0.00    0.00      10/10          kjg_gsl_dgeqrf [77]
-                0.00    0.00      10/10          kjg_gsl_dorgqr [78]
------------------------------------------------
-                0.00    0.00       8/8           first_word [82]
-[80]     0.0    0.00    0.00       8         fnwhite [80]
------------------------------------------------
-                0.00    0.00       1/6           readsnpdata [36]
-                0.00    0.00       1/6           readinddata [45]
-                0.00    0.00       1/6           iseigenstrat [50]
-                0.00    0.00       1/6           ineigenstrat [9]
-                0.00    0.00       2/6           getsizex [35]
-[81]     0.0    0.00    0.00       6         openit [81]
------------------------------------------------
-                0.00    0.00       4/4           openpars [110]
-[82]     0.0    0.00    0.00       4         first_word [82]
-                0.00    0.00       8/8           fnwhite [80]
-                0.00    0.00       4/4           fwhite [83]
------------------------------------------------
-                0.00    0.00       4/4           first_word [82]
-[83]     0.0    0.00    0.00       4         fwhite [83]
------------------------------------------------
-                0.00    0.00       4/4           openpars [110]
-[84]     0.0    0.00    0.00       4         indxstring [84]
------------------------------------------------
-                0.00    0.00       4/4           openpars [110]
-[85]     0.0    0.00    0.00       4         stripcomment [85]
------------------------------------------------
-                0.00    0.00       4/4           openpars [110]
-[86]     0.0    0.00    0.00       4         striptrail [86]
------------------------------------------------
-                0.00    0.00       4/4           dostrsub [96]
-[87]     0.0    0.00    0.00       4         upstring [87]
------------------------------------------------
-                0.00    0.00       1/2           readinddata [45]
-                0.00    0.00       1/2           getgenos [8]
-[88]     0.0    0.00    0.00       2         ispedfile [88]
------------------------------------------------
-                0.00    0.00       2/2           kjg_fpca [12]
-[89]     0.0    0.00    0.00       2         kjg_gsl_SVD [89]
------------------------------------------------
-                0.00    0.00       1/2           numfakes [109]
-                0.00    0.00       1/2           loadsnps [107]
-[90]     0.0    0.00    0.00       2         nextmesh [90]
------------------------------------------------
-                0.00    0.00       1/1           getgenos [8]
-[91]     0.0    0.00    0.00       1         checksize [91]
------------------------------------------------
-                0.00    0.00       1/1           getindivs [38]
-[92]     0.0    0.00    0.00       1         clearind [92]
-                0.00    0.00       1/1           cleartg [93]
------------------------------------------------
-                0.00    0.00       1/1           clearind [92]
-[93]     0.0    0.00    0.00       1         cleartg [93]
-                0.00    0.00    2000/2000        vzero [70]
------------------------------------------------
-                0.00    0.00       1/1           ipsortitp [100]
-[94]     0.0    0.00    0.00       1         copyiparr [94]
------------------------------------------------
-                0.00    0.00       1/1           getsnps [33]
-[95]     0.0    0.00    0.00       1         dobadsnps [95]
------------------------------------------------
-                0.00    0.00       1/1           readcommands [47]
-[96]     0.0    0.00    0.00       1         dostrsub [96]
-                0.00    0.00       4/4           upstring [87]
------------------------------------------------
-                0.00    0.00       1/1           rmsnps [112]
-[97]     0.0    0.00    0.00       1         freesnpindex [97]
------------------------------------------------
-                0.00    0.00       1/1           setgval [24]
-[98]     0.0    0.00    0.00       1         initarray_2Ddouble [98]
------------------------------------------------
-                0.00    0.00       1/1           getsnps [33]
-[99]     0.0    0.00    0.00       1         ipsortit [99]
-                0.00    0.00       1/1           ipsortitp [100]
------------------------------------------------
-                0.00    0.00       1/1           ipsortit [99]
-[100]    0.0    0.00    0.00       1         ipsortitp [100]
-                0.00    0.00       1/1           setorder [115]
-                0.00    0.00       1/1           copyiparr [94]
-                0.00    0.00       1/20001       copyiarr [57]
------------------------------------------------
-                0.00    0.00       1/1           getgenos [8]
-[101]    0.0    0.00    0.00       1         isbedfile [101]
------------------------------------------------
-                0.00    0.00       1/1           readsnpdata [36]
-[102]    0.0    0.00    0.00       1         ismapfile [102]
------------------------------------------------
-                0.00    0.00       1/1           getgenos [8]
-[103]    0.0    0.00    0.00       1         ispack [103]
------------------------------------------------
-                0.00    0.00       1/1           kjg_fpca [12]
-[104]    0.0    0.00    0.00       1         kjg_gsl_ran_ugaussian_matrix [104]
-                0.00    0.00   20000/20000       kjg_gsl_ran_ugaussian_pair [59]
------------------------------------------------
-                0.00    0.00       1/1           kjg_fpca [12]
-[105]    0.0    0.00    0.00       1         kjg_gsl_rng_init [105]
------------------------------------------------
-                0.00    0.00       1/1           main [4]
-[106]    0.0    0.00    0.00       1         loadindx [106]
------------------------------------------------
-                0.00    0.00       1/1           getsnps [33]
-[107]    0.0    0.00    0.00       1         loadsnps [107]
-                0.00    0.00   20000/20000       mknn [60]
-                0.00    0.00   20000/20001       copyiarr [57]
-                0.00    0.00       1/2           nextmesh [90]
------------------------------------------------
-                0.00    0.00       1/1           main [4]
-[108]    0.0    0.00    0.00       1         makeeglist [108]
-                0.00    0.00    2000/2000        indxindex [69]
------------------------------------------------
-                0.00    0.00       1/1           getsnps [33]
-[109]    0.0    0.00    0.00       1         numfakes [109]
-                0.00    0.00       1/2           nextmesh [90]
------------------------------------------------
-                0.00    0.00       1/1           readcommands [47]
-[110]    0.0    0.00    0.00       1         openpars [110]
-                0.00    0.00       4/4           first_word [82]
-                0.00    0.00       4/4           indxstring [84]
-                0.00    0.00       4/4           striptrail [86]
-                0.00    0.00       4/4           stripcomment [85]
------------------------------------------------
-                0.00    0.00       1/1           readcommands [47]
-[111]    0.0    0.00    0.00       1         pcheck [111]
------------------------------------------------
-                0.00    0.00       1/1           main [4]
-[112]    0.0    0.00    0.00       1         rmsnps [112]
-                0.00    0.00       1/1           freesnpindex [97]
------------------------------------------------
-                0.00    0.00       1/1           setgval [24]
-[113]    0.0    0.00    0.00       1         set_ind_mask [113]
------------------------------------------------
-                0.00    0.00       1/1           main [4]
-[114]    0.0    0.00    0.00       1         setomode [114]
------------------------------------------------
-                0.00    0.00       1/1           ipsortitp [100]
-[115]    0.0    0.00    0.00       1         setorder [115]
------------------------------------------------
-                0.00    0.00       1/1           main [4]
-[116]    0.0    0.00    0.00       1         setstatus [116]
-                0.00    0.00       1/1           setstatusv [117]
------------------------------------------------
-                0.00    0.00       1/1           setstatus [116]
-[117]    0.0    0.00    0.00       1         setstatusv [117]
------------------------------------------------
-                0.00    0.00       1/1           main [4]
-[118]    0.0    0.00    0.00       1         transpose [118]
-                0.00    0.00       1/11          copyarr [74]
------------------------------------------------
-                0.00    0.00       1/1           printevecs [1]
-[119]    0.0    0.00    0.00       1         vinvert [119]
------------------------------------------------
-                0.00    0.00       1/1           printevecs [1]
-[120]    0.0    0.00    0.00       1         vsqrt [120]
------------------------------------------------
-                0.00    0.00       1/1           readcommands [47]
-[121]    0.0    0.00    0.00       1         writepars [121]
------------------------------------------------
-
- This table describes the call tree of the program, and was sorted by
- the total amount of time spent in each function and its children.
-
- Each entry in this table consists of several lines.  The line with the
- index number at the left hand margin lists the current function.
- The lines above it list the functions that called this function,
- and the lines below it list the functions this one called.
- This line lists:
-     index	A unique number given to each element of the table.
-		Index numbers are sorted numerically.
-		The index number is printed next to every function name so
-		it is easier to look up where the function in the table.
-
-     % time	This is the percentage of the `total' time that was spent
-		in this function and its children.  Note that due to
-		different viewpoints, functions excluded by options, etc,
-		these numbers will NOT add up to 100%.
-
-     self	This is the total amount of time spent in this function.
-
-     children	This is the total amount of time propagated into this
-		function by its children.
-
-     called	This is the number of times the function was called.
-		If the function called itself recursively, the number
-		only includes non-recursive calls, and is followed by
-		a `+' and the number of recursive calls.
-
-     name	The name of the current function.  The index number is
-		printed after it.  If the function is a member of a
-		cycle, the cycle number is printed between the
-		function's name and the index number.
-
-
- For the function's parents, the fields have the following meanings:
-
-     self	This is the amount of time that was propagated directly
-		from the function into this parent.
-
-     children	This is the amount of time that was propagated from
-		the function's children into this parent.
-
-     called	This is the number of times this parent called the
-		function `/' the total number of times the function
-		was called.  Recursive calls to the function are not
-		included in the number after the `/'.
-
-     name	This is the name of the parent.  The parent's index
-		number is printed after it.  If the parent is a
-		member of a cycle, the cycle number is printed between
-		the name and the index number.
-
- If the parents of the function cannot be determined, the word
- `<spontaneous>' is printed in the `name' field, and all the other
- fields are blank.
-
- For the function's children, the fields have the following meanings:
-
-     self	This is the amount of time that was propagated directly
-		from the child into the function.
-
-     children	This is the amount of time that was propagated from the
-		child's children to the function.
-
-     called	This is the number of times the function called
-		this child `/' the total number of times the child
-		was called.  Recursive calls by the child are not
-		listed in the number after the `/'.
-
-     name	This is the name of the child.  The child's index
-		number is printed after it.  If the child is a
-		member of a cycle, the cycle number is printed
-		between the name and the index number.
-
- If there are any cycles (circles) in the call graph, there is an
- entry for the cycle-as-a-whole.  This entry shows who called the
- cycle (as parents) and the members of the cycle (as children.)
- The `+' recursive calls entry shows the number of function calls that
- were internal to the cycle, and the calls entry for each member shows,
- for that member, how many times it was called from other members of
- the cycle.
-
-
-Index by function name
-
-  [43] LAPACKE_dge_nancheck   [33] getsnps                [17] numvalidgt
-  [34] LAPACKE_dge_trans      [48] getstring              [20] numvalidgtallind
-  [63] NPisnumber             [44] hashit                 [19] numvalidgtx
-  [76] asum2                  [69] indxindex              [81] openit
-  [37] cclear                 [84] indxstring            [110] openpars
-  [91] checksize               [9] ineigenstrat          [111] pcheck
-  [29] checkxval              [98] initarray_2Ddouble      [1] printevecs
-  [51] clearepath             [58] intsum                 [15] putgtypes
-  [92] clearind               [99] ipsortit                [6] rbuff
-  [39] clearsnp              [100] ipsortitp              [45] readinddata
-  [93] cleartg               [101] isbedfile              [36] readsnpdata
-  [53] compiarr               [50] iseigenstrat          [112] rmsnps
-  [74] copyarr               [102] ismapfile             [113] set_ind_mask
-  [57] copyiarr               [64] isnumword              [46] setfvecs
-  [94] copyiparr             [103] ispack                 [24] setgval
-  [95] dobadsnps              [88] ispedfile             [114] setomode
-  [96] dostrsub               [62] ivclear               [115] setorder
-  [71] findpname              [65] ivzero                 [66] setsdpos
-  [82] first_word             [12] kjg_fpca               [56] setskipit
-  [26] floatit                [27] kjg_fpca_XA           [116] setstatus
-  [80] fnwhite                [28] kjg_fpca_XTB          [117] setstatusv
-  [42] freeped                [13] kjg_fpca_XTXA          [30] splitup
-  [97] freesnpindex           [10] kjg_geno_get_normalized_row [31] splitupwxbuff
-  [52] freestring             [11] kjg_geno_get_normalized_rows [67] str2chrom
-  [54] freeup                 [89] kjg_gsl_SVD            [85] stripcomment
-  [22] fvadjust               [77] kjg_gsl_dgeqrf         [86] striptrail
-  [83] fwhite                 [78] kjg_gsl_dorgqr        [118] transpose
-  [72] get_ncols              [79] kjg_gsl_matrix_QR      [25] unsetgval
-  [73] get_nrows             [104] kjg_gsl_ran_ugaussian_matrix [87] upstring
-  [14] getcolxz               [59] kjg_gsl_ran_ugaussian_pair [68] vclear
-  [75] getdbl                [105] kjg_gsl_rng_init        [7] vdot
-  [23] getgall               [106] loadindx              [119] vinvert
-   [8] getgenos              [107] loadsnps               [41] vlmaxmin
-   [3] getggval               [18] loadsnpx              [120] vsqrt
-   [5] getgtypes             [108] makeeglist             [32] vst
-   [2] getgval                [60] mknn                   [70] vzero
-  [38] getindivs              [61] mkupper                [16] wbuff
-  [49] getint                 [90] nextmesh              [121] writepars
-  [21] getrawcol              [55] nnint
-  [35] getsizex              [109] numfakes